@@ -0,0 +1,602 @@
+/*!
+ * @file ws_pb_bench.cpp
+ *
+ * Host micro-benchmark for the protobuf codec. Encodes and decodes the
+ * wippersnapper/.../v1 messages the firmware handles most, filled with
+ * realistic payloads, through ws_pb_encode() and ws_pb_decode(), and
+ * reports the time, encoded size and peak stack of each.
+ *
+ * Usage: program [--iterations N]
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "nanopb/ws_pb_helpers.h"
+#include "wippersnapper/signal/v1/signal.pb.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#define WS_PB_BENCH_BUF_SIZE 1024    ///< Encode buffer, in bytes
+#define WS_PB_BENCH_LIST_LEN 16      ///< Elements in a repeated list field
+#define WS_PB_BENCH_STACK_SIZE 65536 ///< Stack the codec is measured on
+#define WS_PB_BENCH_STACK_FILL 0xA5  ///< Pattern marking unused stack
+
+/** Elements of a repeated submessage field, which nanopb leaves to
+ * callbacks */
+typedef struct {
+  const pb_msgdesc_t *fields; ///< Element message descriptor
+  size_t itemSize;            ///< Element struct size
+  uint8_t *items;             ///< Element storage, WS_PB_BENCH_LIST_LEN long
+  pb_size_t count;            ///< Elements in use
+  pb_size_t tag;              ///< Tag of the oneof member carrying the list
+} ws_pb_bench_list_t;
+
+/** Storage for any top-level message under test */
+typedef union {
+  wippersnapper_signal_v1_CreateSignalRequest signal;  ///< Pin signals
+  wippersnapper_signal_v1_I2CRequest i2cRequest;       ///< I2C requests
+  wippersnapper_signal_v1_I2CResponse i2cResponse;     ///< I2C responses
+  wippersnapper_signal_v1_PixelsRequest pixelsRequest; ///< Pixel requests
+  wippersnapper_signal_v1_UARTResponse uartResponse;   ///< UART responses
+} ws_pb_bench_msg_t;
+
+/** Storage for one element of any list under test */
+typedef union {
+  wippersnapper_pin_v1_ConfigurePinRequest pinConfig;      ///< Pin configs
+  wippersnapper_i2c_v1_I2CDeviceInitRequest i2cDeviceInit; ///< I2C devices
+} ws_pb_bench_item_t;
+
+/** A message under test */
+typedef struct {
+  const char *name;           ///< Label in the report
+  const pb_msgdesc_t *fields; ///< Top-level message descriptor
+  size_t size;                ///< Top-level struct size
+  void (*fill)(void *msg, ws_pb_bench_list_t *list); ///< Builds the payload
+  void (*bindEncode)(void *msg,
+                     ws_pb_bench_list_t *list); ///< Sets encode callbacks
+  void (*bindDecode)(void *msg,
+                     ws_pb_bench_list_t *list); ///< Sets decode callbacks
+  const pb_msgdesc_t *itemFields;               ///< List element descriptor
+  size_t itemSize;                              ///< List element struct size
+  pb_size_t tag; ///< Tag of the oneof member carrying the list
+} ws_pb_bench_case_t;
+
+/****************************************************************************/
+/*!
+    @brief    Encodes each element of a list field.
+    @param    stream
+              Output stream.
+    @param    field
+              Repeated field being encoded.
+    @param    arg
+              The ws_pb_bench_list_t to encode.
+    @returns  True if every element was encoded.
+*/
+/****************************************************************************/
+static bool cbEncodeList(pb_ostream_t *stream, const pb_field_t *field,
+                         void *const *arg) {
+  ws_pb_bench_list_t *list = (ws_pb_bench_list_t *)*arg;
+  for (pb_size_t i = 0; i < list->count; i++) {
+    if (!pb_encode_tag_for_field(stream, field) ||
+        !pb_encode_submessage(stream, list->fields,
+                              &list->items[i * list->itemSize]))
+      return false;
+  }
+  return true;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Decodes one element of a list field, called once per element.
+    @param    stream
+              Input stream, limited to the element.
+    @param    field
+              Repeated field being decoded.
+    @param    arg
+              The ws_pb_bench_list_t to decode into.
+    @returns  True if the element was decoded.
+*/
+/****************************************************************************/
+static bool cbDecodeList(pb_istream_t *stream, const pb_field_t *field,
+                         void **arg) {
+  (void)field;
+  ws_pb_bench_list_t *list = (ws_pb_bench_list_t *)*arg;
+  if (list->count >= WS_PB_BENCH_LIST_LEN)
+    return false;
+  uint8_t *item = &list->items[list->count * list->itemSize];
+  memset(item, 0, list->itemSize);
+  if (!pb_decode(stream, list->fields, item))
+    return false;
+  list->count++;
+  return true;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Sets up the list callback once the signal message's oneof tag
+              is known, as the firmware's cbSignalMsg() does.
+    @param    stream
+              Input stream, limited to the oneof member.
+    @param    field
+              Oneof member about to be decoded.
+    @param    arg
+              The ws_pb_bench_list_t to decode into.
+    @returns  True, other members are decoded without callbacks.
+*/
+/****************************************************************************/
+static bool cbDecodePayload(pb_istream_t *stream, const pb_field_t *field,
+                            void **arg) {
+  (void)stream;
+  ws_pb_bench_list_t *list = (ws_pb_bench_list_t *)*arg;
+  if (field->tag == list->tag) {
+    // ConfigurePinRequests and I2CDeviceInitRequests only hold the list
+    pb_callback_t *cb = (pb_callback_t *)field->pData;
+    cb->funcs.decode = cbDecodeList;
+    cb->arg = list;
+  }
+  return true;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills an I2CResponse with a device event carrying the most
+              sensor events the message allows.
+    @param    msg
+              wippersnapper_signal_v1_I2CResponse to fill.
+    @param    list
+              Unused.
+*/
+/****************************************************************************/
+static void fillI2CResponse(void *msg, ws_pb_bench_list_t *list) {
+  (void)list;
+  static const wippersnapper_i2c_v1_SensorType types[] = {
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RELATIVE_HUMIDITY,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PRESSURE,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ALTITUDE,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_GAS_RESISTANCE,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ECO2,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_TVOC,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOC_INDEX,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_NOX_INDEX,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_LUX,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOLTAGE,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CURRENT,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RAW};
+  static const float values[] = {23.47f, 74.25f,  41.3f,  1013.25f, 112.6f,
+                                 48213.f, 612.f,   587.f,  125.f,    98.f,
+                                 1.f,     342.8f,  3.297f, 0.0412f,  1023.f};
+
+  wippersnapper_signal_v1_I2CResponse *resp =
+      (wippersnapper_signal_v1_I2CResponse *)msg;
+  resp->which_payload =
+      wippersnapper_signal_v1_I2CResponse_resp_i2c_device_event_tag;
+  wippersnapper_i2c_v1_I2CDeviceEvent &event =
+      resp->payload.resp_i2c_device_event;
+  event.sensor_address = 0x77;
+  event.sensor_event_count = 15;
+  for (pb_size_t i = 0; i < event.sensor_event_count; i++) {
+    event.sensor_event[i].type = types[i];
+    event.sensor_event[i].value = values[i];
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills a CreateSignalRequest with the pin configuration sent
+              to a board with every pin in use.
+    @param    msg
+              wippersnapper_signal_v1_CreateSignalRequest to fill.
+    @param    list
+              Receives the ConfigurePinRequest elements.
+*/
+/****************************************************************************/
+static void fillPinConfigs(void *msg, ws_pb_bench_list_t *list) {
+  wippersnapper_signal_v1_CreateSignalRequest *req =
+      (wippersnapper_signal_v1_CreateSignalRequest *)msg;
+  req->which_payload =
+      wippersnapper_signal_v1_CreateSignalRequest_pin_configs_tag;
+
+  list->count = WS_PB_BENCH_LIST_LEN;
+  for (pb_size_t i = 0; i < list->count; i++) {
+    wippersnapper_pin_v1_ConfigurePinRequest *pin =
+        (wippersnapper_pin_v1_ConfigurePinRequest *)&list
+            ->items[i * list->itemSize];
+    bool analog = i >= 12;
+    snprintf(pin->pin_name, sizeof(pin->pin_name), analog ? "A%u" : "D%u",
+             (uint8_t)(analog ? i - 12 : i));
+    pin->mode = analog ? wippersnapper_pin_v1_Mode_MODE_ANALOG
+                       : wippersnapper_pin_v1_Mode_MODE_DIGITAL;
+    pin->direction =
+        i % 3 == 0 ? wippersnapper_pin_v1_ConfigurePinRequest_Direction_DIRECTION_OUTPUT
+                   : wippersnapper_pin_v1_ConfigurePinRequest_Direction_DIRECTION_INPUT;
+    pin->pull = wippersnapper_pin_v1_ConfigurePinRequest_Pull_PULL_UP;
+    pin->period = analog ? 30.0f : 0.0f;
+    pin->request_type =
+        wippersnapper_pin_v1_ConfigurePinRequest_RequestType_REQUEST_TYPE_CREATE;
+    pin->aref = analog ? 3.3f : 0.0f;
+    pin->analog_read_mode =
+        analog ? wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VOLTAGE
+               : wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_UNSPECIFIED;
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Sets the encode callback of a CreateSignalRequest's pin
+              configuration list.
+    @param    msg
+              wippersnapper_signal_v1_CreateSignalRequest to encode.
+    @param    list
+              ConfigurePinRequest elements.
+*/
+/****************************************************************************/
+static void bindPinConfigs(void *msg, ws_pb_bench_list_t *list) {
+  wippersnapper_signal_v1_CreateSignalRequest *req =
+      (wippersnapper_signal_v1_CreateSignalRequest *)msg;
+  req->payload.pin_configs.list.funcs.encode = cbEncodeList;
+  req->payload.pin_configs.list.arg = list;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills an I2CRequest with the device list sent to a board with
+              several sensors attached at boot.
+    @param    msg
+              wippersnapper_signal_v1_I2CRequest to fill.
+    @param    list
+              Receives the I2CDeviceInitRequest elements.
+*/
+/****************************************************************************/
+static void fillI2CDeviceInitRequests(void *msg, ws_pb_bench_list_t *list) {
+  static const char *names[] = {"bme680", "scd40", "sgp40", "veml7700",
+                                "ina219", "sht4x"};
+  static const uint32_t addresses[] = {0x77, 0x62, 0x59, 0x10, 0x40, 0x44};
+  wippersnapper_signal_v1_I2CRequest *req =
+      (wippersnapper_signal_v1_I2CRequest *)msg;
+  req->which_payload =
+      wippersnapper_signal_v1_I2CRequest_req_i2c_device_init_requests_tag;
+
+  list->count = 6;
+  for (pb_size_t i = 0; i < list->count; i++) {
+    wippersnapper_i2c_v1_I2CDeviceInitRequest *dev =
+        (wippersnapper_i2c_v1_I2CDeviceInitRequest *)&list
+            ->items[i * list->itemSize];
+    dev->i2c_port_number = 0;
+    dev->has_i2c_bus_init_req = true;
+    dev->i2c_bus_init_req.i2c_pin_scl = 22;
+    dev->i2c_bus_init_req.i2c_pin_sda = 21;
+    dev->i2c_bus_init_req.i2c_frequency = 100000;
+    dev->i2c_device_address = addresses[i];
+    strncpy(dev->i2c_device_name, names[i], sizeof(dev->i2c_device_name) - 1);
+    dev->i2c_device_properties_count = 4;
+    for (pb_size_t p = 0; p < dev->i2c_device_properties_count; p++) {
+      dev->i2c_device_properties[p].sensor_type =
+          (wippersnapper_i2c_v1_SensorType)(
+              wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RELATIVE_HUMIDITY +
+              p);
+      dev->i2c_device_properties[p].sensor_period = 30 * (p + 1);
+    }
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Sets the encode callback of an I2CRequest's device list.
+    @param    msg
+              wippersnapper_signal_v1_I2CRequest to encode.
+    @param    list
+              I2CDeviceInitRequest elements.
+*/
+/****************************************************************************/
+static void bindI2CDeviceInitRequests(void *msg, ws_pb_bench_list_t *list) {
+  wippersnapper_signal_v1_I2CRequest *req =
+      (wippersnapper_signal_v1_I2CRequest *)msg;
+  req->payload.req_i2c_device_init_requests.list.funcs.encode = cbEncodeList;
+  req->payload.req_i2c_device_init_requests.list.arg = list;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills a PixelsRequest creating a NeoPixel strand.
+    @param    msg
+              wippersnapper_signal_v1_PixelsRequest to fill.
+    @param    list
+              Unused.
+*/
+/****************************************************************************/
+static void fillPixelsCreate(void *msg, ws_pb_bench_list_t *list) {
+  (void)list;
+  wippersnapper_signal_v1_PixelsRequest *req =
+      (wippersnapper_signal_v1_PixelsRequest *)msg;
+  req->which_payload =
+      wippersnapper_signal_v1_PixelsRequest_req_pixels_create_tag;
+  wippersnapper_pixels_v1_PixelsCreateRequest &create =
+      req->payload.req_pixels_create;
+  create.pixels_type =
+      wippersnapper_pixels_v1_PixelsType_PIXELS_TYPE_NEOPIXEL;
+  create.pixels_num = 60;
+  create.pixels_ordering = wippersnapper_pixels_v1_PixelsOrder_PIXELS_ORDER_GRB;
+  create.pixels_brightness = 128;
+  strcpy(create.pixels_pin_neopixel, "D12");
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills a PixelsRequest writing a colour to a NeoPixel strand.
+    @param    msg
+              wippersnapper_signal_v1_PixelsRequest to fill.
+    @param    list
+              Unused.
+*/
+/****************************************************************************/
+static void fillPixelsWrite(void *msg, ws_pb_bench_list_t *list) {
+  (void)list;
+  wippersnapper_signal_v1_PixelsRequest *req =
+      (wippersnapper_signal_v1_PixelsRequest *)msg;
+  req->which_payload =
+      wippersnapper_signal_v1_PixelsRequest_req_pixels_write_tag;
+  wippersnapper_pixels_v1_PixelsWriteRequest &write =
+      req->payload.req_pixels_write;
+  write.pixels_type = wippersnapper_pixels_v1_PixelsType_PIXELS_TYPE_NEOPIXEL;
+  strcpy(write.pixels_pin_data, "D12");
+  write.pixels_color = 0xFF7F00;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Fills a UARTResponse with a PMS5003 particulate reading.
+    @param    msg
+              wippersnapper_signal_v1_UARTResponse to fill.
+    @param    list
+              Unused.
+*/
+/****************************************************************************/
+static void fillUARTResponse(void *msg, ws_pb_bench_list_t *list) {
+  (void)list;
+  static const wippersnapper_i2c_v1_SensorType types[] = {
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_STD,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_STD,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_STD,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_ENV,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_ENV,
+      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_ENV};
+  static const float values[] = {4.f, 7.f, 9.f, 4.f, 7.f, 9.f};
+
+  wippersnapper_signal_v1_UARTResponse *resp =
+      (wippersnapper_signal_v1_UARTResponse *)msg;
+  resp->which_payload =
+      wippersnapper_signal_v1_UARTResponse_resp_uart_device_event_tag;
+  wippersnapper_uart_v1_UARTDeviceEvent &event =
+      resp->payload.resp_uart_device_event;
+  strcpy(event.device_id, "pms5003");
+  event.sensor_event_count = 6;
+  for (pb_size_t i = 0; i < event.sensor_event_count; i++) {
+    event.sensor_event[i].type = types[i];
+    event.sensor_event[i].value = values[i];
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Sets the payload callback of a signal message, each signal
+              message starts with its cb_payload field.
+    @param    msg
+              Signal message to decode into.
+    @param    list
+              Receives the list elements of the payload, if it has any.
+*/
+/****************************************************************************/
+static void bindPayload(void *msg, ws_pb_bench_list_t *list) {
+  pb_callback_t *cb = (pb_callback_t *)msg;
+  cb->funcs.decode = cbDecodePayload;
+  cb->arg = list;
+}
+
+/** Messages under test */
+static const ws_pb_bench_case_t benchCases[] = {
+    {"I2CResponse (15 sensor events)", wippersnapper_signal_v1_I2CResponse_fields,
+     sizeof(wippersnapper_signal_v1_I2CResponse), fillI2CResponse, nullptr,
+     bindPayload, nullptr, 0, 0},
+    {"CreateSignalRequest (16 pin configs)",
+     wippersnapper_signal_v1_CreateSignalRequest_fields,
+     sizeof(wippersnapper_signal_v1_CreateSignalRequest), fillPinConfigs,
+     bindPinConfigs, bindPayload, wippersnapper_pin_v1_ConfigurePinRequest_fields,
+     sizeof(wippersnapper_pin_v1_ConfigurePinRequest),
+     wippersnapper_signal_v1_CreateSignalRequest_pin_configs_tag},
+    {"I2CRequest (6 device inits)", wippersnapper_signal_v1_I2CRequest_fields,
+     sizeof(wippersnapper_signal_v1_I2CRequest), fillI2CDeviceInitRequests,
+     bindI2CDeviceInitRequests, bindPayload,
+     wippersnapper_i2c_v1_I2CDeviceInitRequest_fields,
+     sizeof(wippersnapper_i2c_v1_I2CDeviceInitRequest),
+     wippersnapper_signal_v1_I2CRequest_req_i2c_device_init_requests_tag},
+    {"PixelsRequest (create)", wippersnapper_signal_v1_PixelsRequest_fields,
+     sizeof(wippersnapper_signal_v1_PixelsRequest), fillPixelsCreate, nullptr,
+     bindPayload, nullptr, 0, 0},
+    {"PixelsRequest (write)", wippersnapper_signal_v1_PixelsRequest_fields,
+     sizeof(wippersnapper_signal_v1_PixelsRequest), fillPixelsWrite, nullptr,
+     bindPayload, nullptr, 0, 0},
+    {"UARTResponse (PMS5003 event)", wippersnapper_signal_v1_UARTResponse_fields,
+     sizeof(wippersnapper_signal_v1_UARTResponse), fillUARTResponse, nullptr,
+     bindPayload, nullptr, 0, 0},
+};
+
+/** State shared with the function run on the measured stack */
+static struct {
+  const ws_pb_bench_case_t *benchCase; ///< Message under test
+  void *msg;                           ///< Struct to encode or decode into
+  ws_pb_bench_list_t *list;            ///< List elements of msg
+  uint8_t *buf;                        ///< Encoded message
+  size_t len;                          ///< Length of buf, in bytes
+  bool encode;                         ///< Encode rather than decode
+  bool ok;                             ///< Result of the operation
+} benchOp;
+
+static ucontext_t benchMainCtx; ///< Context to return to after benchOpRun
+static ucontext_t benchOpCtx;   ///< Context running on the measured stack
+
+/****************************************************************************/
+/*!
+    @brief    Encodes or decodes benchOp.msg, as set up by the caller.
+*/
+/****************************************************************************/
+static void benchOpRun() {
+  const ws_pb_bench_case_t *c = benchOp.benchCase;
+  if (benchOp.encode) {
+    benchOp.len = ws_pb_encode_to_buffer(benchOp.buf, WS_PB_BENCH_BUF_SIZE,
+                                         c->fields, benchOp.msg);
+    benchOp.ok = benchOp.len > 0;
+  } else {
+    memset(benchOp.msg, 0, c->size);
+    benchOp.list->count = 0;
+    c->bindDecode(benchOp.msg, benchOp.list);
+    pb_istream_t stream = pb_istream_from_buffer(benchOp.buf, benchOp.len);
+    benchOp.ok = ws_pb_decode(&stream, c->fields, benchOp.msg);
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Does nothing, measures the stack used to enter a context.
+*/
+/****************************************************************************/
+static void benchOpNop() {}
+
+/****************************************************************************/
+/*!
+    @brief    Runs a function on a stack painted with a fill pattern and
+              finds how deep it reached.
+    @param    entry
+              Function to run, returns to benchMainCtx.
+    @returns  Bytes of stack used.
+*/
+/****************************************************************************/
+static size_t benchStackUsed(void (*entry)()) {
+  static uint8_t stack[WS_PB_BENCH_STACK_SIZE];
+  memset(stack, WS_PB_BENCH_STACK_FILL, sizeof(stack));
+  getcontext(&benchOpCtx);
+  benchOpCtx.uc_stack.ss_sp = stack;
+  benchOpCtx.uc_stack.ss_size = sizeof(stack);
+  benchOpCtx.uc_link = &benchMainCtx;
+  makecontext(&benchOpCtx, entry, 0);
+  swapcontext(&benchMainCtx, &benchOpCtx);
+
+  // The stack grows down, the lowest overwritten byte is the peak
+  size_t untouched = 0;
+  while (untouched < sizeof(stack) &&
+         stack[untouched] == WS_PB_BENCH_STACK_FILL)
+    untouched++;
+  return sizeof(stack) - untouched;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Times benchOp over a number of iterations.
+    @param    iterations
+              Times to run the operation.
+    @returns  Mean host time per operation, in nanoseconds.
+*/
+/****************************************************************************/
+static double benchTime(long iterations) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++)
+    benchOpRun();
+  uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+  return iterations ? (double)ns / iterations : 0.0;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Benchmarks one message and prints its row of the report.
+    @param    c
+              Message under test.
+    @param    iterations
+              Times to encode and decode the message.
+    @param    stackBaseline
+              Stack used to enter the measured context, subtracted.
+    @returns  True if the message survived an encode/decode round trip.
+*/
+/****************************************************************************/
+static bool benchCase(const ws_pb_bench_case_t *c, long iterations,
+                      size_t stackBaseline) {
+  static ws_pb_bench_msg_t srcMsg, dstMsg;
+  static ws_pb_bench_item_t srcItems[WS_PB_BENCH_LIST_LEN];
+  static ws_pb_bench_item_t dstItems[WS_PB_BENCH_LIST_LEN];
+  static uint8_t buf[WS_PB_BENCH_BUF_SIZE];
+  static uint8_t reencoded[WS_PB_BENCH_BUF_SIZE];
+  ws_pb_bench_list_t srcList = {c->itemFields, c->itemSize,
+                                (uint8_t *)srcItems, 0, c->tag};
+  ws_pb_bench_list_t dstList = {c->itemFields, c->itemSize,
+                                (uint8_t *)dstItems, 0, c->tag};
+  memset(&srcMsg, 0, sizeof(srcMsg));
+  memset(srcItems, 0, sizeof(srcItems));
+  c->fill(&srcMsg, &srcList);
+  if (c->bindEncode != nullptr)
+    c->bindEncode(&srcMsg, &srcList);
+
+  benchOp.benchCase = c;
+  benchOp.buf = buf;
+  benchOp.encode = true;
+  benchOp.msg = &srcMsg;
+  benchOp.list = &srcList;
+  size_t encodeStack = benchStackUsed(benchOpRun) - stackBaseline;
+  if (!benchOp.ok) {
+    printf("%-38s encode failed\n", c->name);
+    return false;
+  }
+  size_t len = benchOp.len;
+  double encodeNs = benchTime(iterations);
+
+  benchOp.encode = false;
+  benchOp.msg = &dstMsg;
+  benchOp.list = &dstList;
+  size_t decodeStack = benchStackUsed(benchOpRun) - stackBaseline;
+  if (!benchOp.ok) {
+    printf("%-38s decode failed\n", c->name);
+    return false;
+  }
+  double decodeNs = benchTime(iterations);
+
+  // Re-encode what was decoded, it must match the original bytes
+  pb_callback_t *payloadCb = (pb_callback_t *)&dstMsg;
+  payloadCb->funcs.encode = nullptr;
+  if (c->bindEncode != nullptr)
+    c->bindEncode(&dstMsg, &dstList);
+  size_t reencodedLen =
+      ws_pb_encode_to_buffer(reencoded, sizeof(reencoded), c->fields, &dstMsg);
+  bool ok = reencodedLen == len && memcmp(buf, reencoded, len) == 0;
+
+  printf("%-38s %6zu %10.0f %10.0f %8zu %8zu%s\n", c->name, len, encodeNs,
+         decodeNs, encodeStack, decodeStack, ok ? "" : "  ROUND TRIP MISMATCH");
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  long iterations = 100000;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+      iterations = atol(argv[++i]);
+  }
+
+  size_t stackBaseline = benchStackUsed(benchOpNop);
+  printf("nanopb codec, %ld iterations per message\n", iterations);
+  printf("%-38s %6s %10s %10s %8s %8s\n", "message", "bytes", "enc ns",
+         "dec ns", "enc stk", "dec stk");
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(benchCases) / sizeof(benchCases[0]); i++)
+    ok &= benchCase(&benchCases[i], iterations, stackBaseline);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+/*!
+ * @file Adafruit_DotStar.h
+ *
+ * Host (Linux) stand-in for the Adafruit DotStar library.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_DOTSTAR_H
+#define WS_NATIVE_DOTSTAR_H
+
+#include "ws_native_pixels.h"
+
+#define DOTSTAR_RGB (0 | (1 << 2) | (2 << 4))
+#define DOTSTAR_RBG (0 | (2 << 2) | (1 << 4))
+#define DOTSTAR_GRB (1 | (0 << 2) | (2 << 4))
+#define DOTSTAR_GBR (2 | (0 << 2) | (1 << 4))
+#define DOTSTAR_BRG (1 | (2 << 2) | (0 << 4))
+#define DOTSTAR_BGR (2 | (1 << 2) | (0 << 4))
+#define DOTSTAR_MONO 0
+
+/** Simulated APA102 strand, 4us of wire time per pixel */
+class Adafruit_DotStar : public ws_native_pixels {
+public:
+  Adafruit_DotStar(uint16_t n, uint8_t data, uint8_t clock,
+                   uint8_t order = DOTSTAR_BRG)
+      : ws_native_pixels(n, data, 4), _clock(clock), _order(order) {}
+  Adafruit_DotStar(uint16_t n = 0, uint8_t order = DOTSTAR_BRG)
+      : ws_native_pixels(n, -1, 4), _clock(-1), _order(order) {}
+  void updateLength(uint16_t n) { _pixels.assign(n, 0); }
+
+private:
+  int16_t _clock; ///< Clock pin, -1 for hardware SPI
+  uint8_t _order; ///< Color order
+};
+
+#endif // WS_NATIVE_DOTSTAR_H
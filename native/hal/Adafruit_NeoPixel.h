@@ -0,0 +1,46 @@
+/*!
+ * @file Adafruit_NeoPixel.h
+ *
+ * Host (Linux) stand-in for the Adafruit NeoPixel library.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_NEOPIXEL_H
+#define WS_NATIVE_NEOPIXEL_H
+
+#include "ws_native_pixels.h"
+
+typedef uint16_t neoPixelType; ///< Color order and bitstream speed flags
+
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_BRG ((1 << 6) | (1 << 4) | (2 << 2) | (0))
+#define NEO_RGBW ((3 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRBW ((3 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+/** Simulated WS2812 strand, 30us of wire time per pixel */
+class Adafruit_NeoPixel : public ws_native_pixels {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6,
+                    neoPixelType type = NEO_GRB + NEO_KHZ800)
+      : ws_native_pixels(n, pin, 30), _type(type) {}
+  Adafruit_NeoPixel() : ws_native_pixels(0, -1, 30), _type(NEO_GRB) {}
+  void setPin(int16_t p) { _pin = p; }
+  void updateLength(uint16_t n) { _pixels.assign(n, 0); }
+  void updateType(neoPixelType t) { _type = t; }
+  bool canShow() { return true; }
+
+private:
+  neoPixelType _type; ///< Color order and bitstream speed
+};
+
+#endif // WS_NATIVE_NEOPIXEL_H
@@ -0,0 +1,17 @@
+/*!
+ * @file Adafruit_SleepyDog.cpp
+ *
+ * Host (Linux) stand-in for the Adafruit SleepyDog watchdog library.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "Adafruit_SleepyDog.h"
+
+WatchdogType Watchdog;
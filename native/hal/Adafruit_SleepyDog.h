@@ -0,0 +1,44 @@
+/*!
+ * @file Adafruit_SleepyDog.h
+ *
+ * Host (Linux) stand-in for the Adafruit SleepyDog watchdog library. The
+ * watchdog never bites, but feeds are counted so the loop can be profiled.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_SLEEPYDOG_H
+#define WS_NATIVE_SLEEPYDOG_H
+
+#include "Arduino.h"
+
+/** Simulated watchdog timer */
+class WatchdogType {
+public:
+  int enable(int maxPeriodMS = 0, bool isForSleep = false) {
+    (void)isForSleep;
+    _periodMS = maxPeriodMS;
+    return maxPeriodMS;
+  }
+  void reset() { _feeds++; }
+  void disable() { _periodMS = 0; }
+  int sleep(int maxPeriodMS = 0) {
+    delay((unsigned long)maxPeriodMS);
+    return maxPeriodMS;
+  }
+  uint32_t ws_native_feeds() { return _feeds; }
+
+private:
+  int _periodMS = 0;   ///< Configured timeout, in milliseconds
+  uint32_t _feeds = 0; ///< Number of calls to reset()
+};
+
+extern WatchdogType Watchdog;
+
+#endif // WS_NATIVE_SLEEPYDOG_H
@@ -0,0 +1,436 @@
+/*!
+ * @file Arduino.cpp
+ *
+ * Host (Linux) stand-in for the Arduino core: virtual clock, simulated
+ * GPIO/ADC pins, Print/Stream formatting and the console UART.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "Arduino.h"
+#include <math.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+
+static uint64_t _now_us = 0; ///< Virtual time since boot, in microseconds
+
+/** Simulated state of a single GPIO pin */
+struct nativePin {
+  uint8_t mode = INPUT;      ///< Configured pin mode
+  int digital = HIGH;        ///< Level returned by digitalRead()
+  int analog = 0;            ///< 10-bit value returned by analogRead()
+  int waveAmp = 0;           ///< Amplitude of a sine wave added to analog
+  float waveHz = 0;          ///< Frequency of the sine wave, in Hz
+  int output = LOW;          ///< Last value written by the firmware
+  void (*isr)(void) = nullptr; ///< Attached interrupt handler
+  int isrMode = 0;           ///< Interrupt trigger mode
+};
+static nativePin _pins[WS_NATIVE_NUM_PINS];
+static int _analogReadBits = 10; ///< analogReadResolution() setting
+
+/****************************************************************************/
+/*!
+    @brief    Advances the virtual clock.
+    @param    us
+              Number of microseconds to advance.
+*/
+/****************************************************************************/
+void ws_native_advance_us(uint64_t us) { _now_us += us; }
+
+/****************************************************************************/
+/*!
+    @brief    Returns the virtual clock without advancing it.
+    @returns  Virtual time since boot, in microseconds.
+*/
+/****************************************************************************/
+uint64_t ws_native_now_us() { return _now_us; }
+
+unsigned long millis() {
+  _now_us += WS_NATIVE_CLOCK_TICK_US;
+  return (unsigned long)(_now_us / 1000ULL);
+}
+
+unsigned long micros() {
+  _now_us += WS_NATIVE_CLOCK_TICK_US;
+  return (unsigned long)_now_us;
+}
+
+void delay(unsigned long ms) { _now_us += (uint64_t)ms * 1000ULL; }
+
+void delayMicroseconds(unsigned int us) { _now_us += us; }
+
+void yield() {}
+
+/****************************************************************************/
+/*!
+    @brief    Sets the level an input pin reads back and fires any
+              attached interrupt handler on a matching edge.
+    @param    pin
+              Pin number.
+    @param    val
+              New pin level, HIGH or LOW.
+*/
+/****************************************************************************/
+void ws_native_set_digital(uint8_t pin, int val) {
+  if (pin >= WS_NATIVE_NUM_PINS)
+    return;
+  nativePin &p = _pins[pin];
+  int prv = p.digital;
+  p.digital = val ? HIGH : LOW;
+  if (p.isr == nullptr || prv == p.digital)
+    return;
+  if (p.isrMode == CHANGE || (p.isrMode == RISING && p.digital == HIGH) ||
+      (p.isrMode == FALLING && p.digital == LOW))
+    p.isr();
+}
+
+/****************************************************************************/
+/*!
+    @brief    Sets the value an analog pin reads back.
+    @param    pin
+              Pin number.
+    @param    val
+              Raw 10-bit ADC value.
+*/
+/****************************************************************************/
+void ws_native_set_analog(uint8_t pin, int val) {
+  if (pin < WS_NATIVE_NUM_PINS)
+    _pins[pin].analog = val;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Adds a sine wave to the value an analog pin reads back, so
+              continuous sampling sees a signal that moves with the
+              virtual clock.
+    @param    pin
+              Pin number.
+    @param    amplitude
+              Peak amplitude, in 10-bit ADC counts, 0 to remove the wave.
+    @param    freqHz
+              Frequency of the wave, in Hz.
+*/
+/****************************************************************************/
+void ws_native_set_analog_wave(uint8_t pin, int amplitude, float freqHz) {
+  if (pin >= WS_NATIVE_NUM_PINS)
+    return;
+  _pins[pin].waveAmp = amplitude;
+  _pins[pin].waveHz = freqHz;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Returns the value an analog pin reads at a point in virtual
+              time, without advancing the clock.
+    @param    pin
+              Pin number.
+    @param    us
+              Virtual time, in microseconds.
+    @returns  Raw 10-bit ADC value.
+*/
+/****************************************************************************/
+int ws_native_analog_at(uint8_t pin, uint64_t us) {
+  if (pin >= WS_NATIVE_NUM_PINS)
+    return 0;
+  const nativePin &p = _pins[pin];
+  int val = p.analog;
+  if (p.waveAmp != 0) {
+    double phase = fmod((double)us * p.waveHz / 1000000.0, 1.0);
+    val += (int)lround(p.waveAmp * sin(2.0 * M_PI * phase));
+  }
+  return val < 0 ? 0 : (val > 1023 ? 1023 : val);
+}
+
+/****************************************************************************/
+/*!
+    @brief    Returns the last value the firmware wrote to a pin.
+    @param    pin
+              Pin number.
+    @returns  Last digitalWrite()/analogWrite() value.
+*/
+/****************************************************************************/
+int ws_native_get_output(uint8_t pin) {
+  return pin < WS_NATIVE_NUM_PINS ? _pins[pin].output : 0;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < WS_NATIVE_NUM_PINS)
+    _pins[pin].mode = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < WS_NATIVE_NUM_PINS)
+    _pins[pin].output = val;
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= WS_NATIVE_NUM_PINS)
+    return LOW;
+  if (_pins[pin].mode == OUTPUT)
+    return _pins[pin].output;
+  return _pins[pin].digital;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Simulates a GPIO port's input register, 32 pins per port.
+    @param    port
+              Port number, from digitalPinToPort().
+    @returns  Register holding the level of each of the port's pins, valid
+              until the next call.
+*/
+/****************************************************************************/
+volatile uint32_t *ws_native_port_input(uint8_t port) {
+  static volatile uint32_t reg;
+  reg = 0;
+  for (uint8_t bit = 0; bit < 32; bit++) {
+    uint32_t pin = (uint32_t)port * 32 + bit;
+    if (pin < WS_NATIVE_NUM_PINS && digitalRead((uint8_t)pin))
+      reg |= 1UL << bit;
+  }
+  return &reg;
+}
+
+int analogRead(uint8_t pin) {
+  if (pin >= WS_NATIVE_NUM_PINS)
+    return 0;
+  int val = ws_native_analog_at(pin, _now_us);
+  if (_analogReadBits > 10)
+    return val << (_analogReadBits - 10);
+  return val >> (10 - _analogReadBits);
+}
+
+void analogReadResolution(int bits) { _analogReadBits = bits; }
+
+void analogWriteResolution(int bits) { (void)bits; }
+
+void analogWrite(uint8_t pin, int val) { digitalWrite(pin, (uint8_t)val); }
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+  (void)duration;
+  if (pin < WS_NATIVE_NUM_PINS)
+    _pins[pin].output = (int)frequency;
+}
+
+void noTone(uint8_t pin) { digitalWrite(pin, LOW); }
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode) {
+  if (interruptNum >= WS_NATIVE_NUM_PINS)
+    return;
+  _pins[interruptNum].isr = userFunc;
+  _pins[interruptNum].isrMode = mode;
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+  if (interruptNum < WS_NATIVE_NUM_PINS)
+    _pins[interruptNum].isr = nullptr;
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout) {
+  (void)pin;
+  (void)state;
+  _now_us += timeout;
+  return 0;
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+              uint8_t val) {
+  (void)dataPin;
+  (void)clockPin;
+  (void)bitOrder;
+  (void)val;
+}
+
+uint8_t shiftIn(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder) {
+  (void)clockPin;
+  (void)bitOrder;
+  return digitalRead(dataPin) ? 0xFF : 0x00;
+}
+
+long random(long howbig) { return howbig > 0 ? ::random() % howbig : 0; }
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig)
+    return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) { srandom((unsigned int)seed); }
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static char *_ultoa_base(unsigned long value, char *str, int base) {
+  char tmp[8 * sizeof(unsigned long) + 1];
+  int i = 0;
+  if (base < 2 || base > 36)
+    base = 10;
+  do {
+    int digit = (int)(value % (unsigned long)base);
+    tmp[i++] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+    value /= (unsigned long)base;
+  } while (value);
+  for (int j = 0; j < i; j++)
+    str[j] = tmp[i - 1 - j];
+  str[i] = '\0';
+  return str;
+}
+
+char *ultoa(unsigned long value, char *str, int base) {
+  return _ultoa_base(value, str, base);
+}
+
+char *utoa(unsigned int value, char *str, int base) {
+  return _ultoa_base(value, str, base);
+}
+
+char *ltoa(long value, char *str, int base) {
+  if (value < 0 && base == 10) {
+    str[0] = '-';
+    _ultoa_base((unsigned long)(-value), str + 1, base);
+    return str;
+  }
+  return _ultoa_base((unsigned long)value, str, base);
+}
+
+char *itoa(int value, char *str, int base) { return ltoa(value, str, base); }
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *sout) {
+  sprintf(sout, "%*.*f", width, prec, val);
+  return sout;
+}
+
+String::String(int value, unsigned char base) {
+  char buf[34];
+  _s = itoa(value, buf, base);
+}
+
+String::String(unsigned int value, unsigned char base) {
+  char buf[34];
+  _s = utoa(value, buf, base);
+}
+
+String::String(long value, unsigned char base) {
+  char buf[66];
+  _s = ltoa(value, buf, base);
+}
+
+String::String(unsigned long value, unsigned char base) {
+  char buf[66];
+  _s = ultoa(value, buf, base);
+}
+
+String::String(float value, unsigned char decimalPlaces) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, (double)value);
+  _s = buf;
+}
+
+String::String(double value, unsigned char decimalPlaces) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  _s = buf;
+}
+
+void String::trim() {
+  size_t begin = _s.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) {
+    _s.clear();
+    return;
+  }
+  size_t end = _s.find_last_not_of(" \t\r\n");
+  _s = _s.substr(begin, end - begin + 1);
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (write(*buffer++))
+      n++;
+    else
+      break;
+  }
+  return n;
+}
+
+size_t Print::print(long n, int base) {
+  char buf[8 * sizeof(long) + 2];
+  return write(ltoa(n, buf, base));
+}
+
+size_t Print::print(unsigned long n, int base) {
+  char buf[8 * sizeof(long) + 1];
+  return write(ultoa(n, buf, base));
+}
+
+size_t Print::print(double n, int digits) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+  return write((const uint8_t *)buf,
+               std::min((size_t)len, sizeof(buf) - 1));
+}
+
+int Stream::timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0)
+      return c;
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0)
+      break;
+    *buffer++ = (char)c;
+    count++;
+  }
+  return count;
+}
+
+String Stream::readString() {
+  String ret;
+  int c = timedRead();
+  while (c >= 0) {
+    ret += (char)c;
+    c = timedRead();
+  }
+  return ret;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  // Only the console is echoed to the host, other UARTs are silent sinks
+  if (_uartNum == 0 && !_muted)
+    fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+void HardwareSerial::flush() {
+  if (_uartNum == 0)
+    fflush(stdout);
+}
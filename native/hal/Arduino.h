@@ -0,0 +1,428 @@
+/*!
+ * @file Arduino.h
+ *
+ * Host (Linux) stand-in for the Arduino core, used by the `native`
+ * PlatformIO environment to run WipperSnapper on a workstation.
+ *
+ * Time is virtual: it only moves forward when the firmware calls delay(),
+ * delayMicroseconds(), reads the clock, or the host harness advances it
+ * with ws_native_advance_us(). This makes every run deterministic.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_ARDUINO_H
+#define WS_NATIVE_ARDUINO_H
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+#ifndef ARDUINO
+#define ARDUINO 10819 ///< Arduino API level reported to libraries
+#endif
+
+#define WS_NATIVE_NUM_PINS 64 ///< Number of simulated GPIO pins
+#define WS_NATIVE_CLOCK_TICK_US                                                \
+  1 ///< Virtual time consumed by each millis()/micros() call, guarantees
+    ///< forward progress for busy-wait loops
+
+typedef uint8_t byte;     ///< Arduino byte type
+typedef bool boolean;     ///< Arduino boolean type
+typedef uint16_t word;    ///< Arduino word type
+typedef uint32_t pin_size_t; ///< Pin number type used by newer cores
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+
+#define CHANGE 0x03
+#define FALLING 0x02
+#define RISING 0x01
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define LED_BUILTIN 13
+#define SDA 20
+#define SCL 21
+
+#define SERIAL_8N1 0x06 ///< UART frame format, 8 data bits, no parity, 1 stop
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strncasecmp_P strncasecmp
+#define memcpy_P memcpy
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue)                                         \
+  ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define bit(b) (1UL << (b))
+
+#define digitalPinToInterrupt(p) (p)
+#define digitalPinToPort(p) ((p) / 32)
+#define digitalPinToBitMask(p) (1UL << ((p) % 32))
+#define portInputRegister(port) ws_native_port_input(port)
+#define interrupts()
+#define noInterrupts()
+#define IRAM_ATTR
+
+using std::max;
+using std::min;
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+
+class __FlashStringHelper;
+#define F(string_literal)                                                      \
+  (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// Digital and analog I/O
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogReadResolution(int bits);
+void analogWriteResolution(int bits);
+void analogWrite(uint8_t pin, int val);
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode);
+void detachInterrupt(uint8_t interruptNum);
+unsigned long pulseIn(uint8_t pin, uint8_t state,
+                      unsigned long timeout = 1000000L);
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder,
+              uint8_t val);
+uint8_t shiftIn(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder);
+
+// Math
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// Non-standard libc helpers provided by every Arduino core
+char *itoa(int value, char *str, int base);
+char *ltoa(long value, char *str, int base);
+char *utoa(unsigned int value, char *str, int base);
+char *ultoa(unsigned long value, char *str, int base);
+char *dtostrf(double val, signed char width, unsigned char prec, char *sout);
+
+// Host-side hooks for driving the simulated board
+void ws_native_advance_us(uint64_t us);
+uint64_t ws_native_now_us();
+void ws_native_set_digital(uint8_t pin, int val);
+void ws_native_set_analog(uint8_t pin, int val);
+void ws_native_set_analog_wave(uint8_t pin, int amplitude, float freqHz);
+int ws_native_analog_at(uint8_t pin, uint64_t us);
+int ws_native_get_output(uint8_t pin);
+volatile uint32_t *ws_native_port_input(uint8_t port);
+
+/**************************************************************************/
+/*!
+    @brief  Minimal Arduino String, backed by std::string.
+*/
+/**************************************************************************/
+class String {
+public:
+  String(const char *cstr = "") : _s(cstr ? cstr : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(const __FlashStringHelper *str)
+      : _s(reinterpret_cast<const char *>(str)) {}
+  String(char c) : _s(1, c) {}
+  String(int value, unsigned char base = 10);
+  String(unsigned int value, unsigned char base = 10);
+  String(long value, unsigned char base = 10);
+  String(unsigned long value, unsigned char base = 10);
+  String(float value, unsigned char decimalPlaces = 2);
+  String(double value, unsigned char decimalPlaces = 2);
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return (unsigned int)_s.length(); }
+  bool reserve(unsigned int size) {
+    _s.reserve(size);
+    return true;
+  }
+  bool concat(const String &str) {
+    _s += str._s;
+    return true;
+  }
+  bool concat(const char *cstr) {
+    if (cstr)
+      _s += cstr;
+    return cstr != nullptr;
+  }
+  bool concat(const char *cstr, unsigned int length) {
+    _s.append(cstr, length);
+    return true;
+  }
+  bool concat(char c) {
+    _s += c;
+    return true;
+  }
+  char charAt(unsigned int index) const {
+    return index < _s.length() ? _s[index] : 0;
+  }
+  char operator[](unsigned int index) const { return charAt(index); }
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t pos = _s.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+  int indexOf(const String &str, unsigned int from = 0) const {
+    size_t pos = _s.find(str._s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+  String substring(unsigned int beginIndex) const {
+    return beginIndex < _s.length() ? String(_s.substr(beginIndex)) : String();
+  }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex >= _s.length() || endIndex <= beginIndex)
+      return String();
+    return String(_s.substr(beginIndex, endIndex - beginIndex));
+  }
+  bool equals(const String &s) const { return _s == s._s; }
+  bool equals(const char *cstr) const { return _s == (cstr ? cstr : ""); }
+  bool startsWith(const String &prefix) const {
+    return _s.compare(0, prefix._s.length(), prefix._s) == 0;
+  }
+  bool endsWith(const String &suffix) const {
+    return _s.length() >= suffix._s.length() &&
+           _s.compare(_s.length() - suffix._s.length(), suffix._s.length(),
+                      suffix._s) == 0;
+  }
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return (float)atof(_s.c_str()); }
+  void trim();
+  void toLowerCase() {
+    for (char &c : _s)
+      c = (char)tolower(c);
+  }
+  void toUpperCase() {
+    for (char &c : _s)
+      c = (char)toupper(c);
+  }
+
+  String &operator+=(const String &rhs) {
+    concat(rhs);
+    return *this;
+  }
+  String &operator+=(const char *cstr) {
+    concat(cstr);
+    return *this;
+  }
+  String &operator+=(char c) {
+    concat(c);
+    return *this;
+  }
+  friend String operator+(const String &lhs, const String &rhs) {
+    return String(lhs._s + rhs._s);
+  }
+  friend String operator+(const String &lhs, const char *rhs) {
+    return String(lhs._s + (rhs ? rhs : ""));
+  }
+  bool operator==(const String &rhs) const { return _s == rhs._s; }
+  bool operator==(const char *rhs) const { return equals(rhs); }
+  bool operator!=(const String &rhs) const { return _s != rhs._s; }
+  bool operator!=(const char *rhs) const { return !equals(rhs); }
+
+private:
+  std::string _s;
+};
+
+/**************************************************************************/
+/*!
+    @brief  Arduino Print interface.
+*/
+/**************************************************************************/
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) {
+    return str ? write((const uint8_t *)str, strlen(str)) : 0;
+  }
+  size_t write(const char *buffer, size_t size) {
+    return write((const uint8_t *)buffer, size);
+  }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper *ifsh) {
+    return write(reinterpret_cast<const char *>(ifsh));
+  }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(const char str[]) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char b, int base = DEC) {
+    return print((unsigned long)b, base);
+  }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(long long n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned long long n, int base = DEC) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(double n, int digits = 2);
+
+  template <typename T> size_t println(T value) {
+    size_t n = print(value);
+    return n + println();
+  }
+  template <typename T> size_t println(T value, int format) {
+    size_t n = print(value, format);
+    return n + println();
+  }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char *format, ...)
+      __attribute__((format(printf, 2, 3)));
+};
+
+/**************************************************************************/
+/*!
+    @brief  Arduino Stream interface.
+*/
+/**************************************************************************/
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() { return _timeout; }
+  size_t readBytes(char *buffer, size_t length);
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    return readBytes((char *)buffer, length);
+  }
+  String readString();
+
+protected:
+  int timedRead();
+  unsigned long _timeout = 1000; ///< Stream read timeout, in milliseconds
+};
+
+/**************************************************************************/
+/*!
+    @brief  Simulated UART. Bytes written by the firmware are captured in
+            a TX buffer, bytes injected by the harness with
+            ws_native_inject() are returned by read().
+*/
+/**************************************************************************/
+class HardwareSerial : public Stream {
+public:
+  HardwareSerial(int uartNum = 0) : _uartNum(uartNum) {}
+  void begin(unsigned long baud) { _baud = baud; }
+  void begin(unsigned long baud, uint32_t config, int8_t rxPin = -1,
+             int8_t txPin = -1, bool invert = false) {
+    (void)config;
+    (void)rxPin;
+    (void)txPin;
+    (void)invert;
+    _baud = baud;
+  }
+  void end() {}
+  int available() override { return (int)(_rx.size() - _rxPos); }
+  int read() override {
+    if (_rxPos >= _rx.size())
+      return -1;
+    return (uint8_t)_rx[_rxPos++];
+  }
+  int peek() override {
+    return _rxPos < _rx.size() ? (uint8_t)_rx[_rxPos] : -1;
+  }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override;
+  operator bool() const { return true; }
+
+  void ws_native_inject(const uint8_t *data, size_t len) {
+    if (_rxPos == _rx.size()) {
+      _rx.clear();
+      _rxPos = 0;
+    }
+    _rx.append((const char *)data, len);
+  }
+  void ws_native_mute(bool mute) { _muted = mute; }
+
+protected:
+  int _uartNum;          ///< UART peripheral index, 0 is the console
+  unsigned long _baud = 0; ///< Configured baud rate
+  std::string _rx;       ///< Pending RX bytes
+  size_t _rxPos = 0;     ///< Read position within _rx
+  bool _muted = false;   ///< True to drop console output
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+void setup();
+void loop();
+
+#endif // WS_NATIVE_ARDUINO_H
@@ -0,0 +1,111 @@
+/*!
+ * @file DallasTemperature.h
+ *
+ * Host (Linux) stand-in for the DallasTemperature library, backed by the
+ * simulated probes attached to a OneWire bus.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_DALLASTEMPERATURE_H
+#define WS_NATIVE_DALLASTEMPERATURE_H
+
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127     ///< Error value for getTempC()
+#define DEVICE_DISCONNECTED_F -196.6   ///< Error value for getTempF()
+#define DEVICE_DISCONNECTED_RAW -7040  ///< Error value for getTemp()
+
+typedef uint8_t DeviceAddress[8]; ///< 64-bit ROM code
+
+/** Simulated DS18x20 driver */
+class DallasTemperature {
+public:
+  DallasTemperature(OneWire *oneWire) : _wire(oneWire) {}
+  void begin() {}
+  uint8_t getDeviceCount() {
+    return (uint8_t)ws_native_onewire_probes(_wire->getPin()).size();
+  }
+  bool getAddress(uint8_t *deviceAddress, uint8_t index);
+  bool validAddress(const uint8_t *deviceAddress) {
+    return OneWire::crc8(deviceAddress, 7) == deviceAddress[7];
+  }
+  bool validFamily(const uint8_t *deviceAddress) {
+    switch (deviceAddress[0]) {
+    case 0x10: // DS18S20
+    case 0x22: // DS1822
+    case 0x28: // DS18B20
+    case 0x3B: // DS1825
+    case 0x42: // DS28EA00
+      return true;
+    default:
+      return false;
+    }
+  }
+  bool isConnected(const uint8_t *deviceAddress);
+  bool setResolution(const uint8_t *deviceAddress, uint8_t newResolution) {
+    (void)deviceAddress;
+    _resolution = constrain(newResolution, 9, 12);
+    return true;
+  }
+  void setResolution(uint8_t newResolution) {
+    _resolution = constrain(newResolution, 9, 12);
+  }
+  uint8_t getResolution() { return _resolution; }
+  uint8_t getResolution(const uint8_t *deviceAddress) {
+    (void)deviceAddress;
+    return _resolution;
+  }
+  void setWaitForConversion(bool flag) { _waitForConversion = flag; }
+  bool getWaitForConversion() { return _waitForConversion; }
+  int16_t millisToWaitForConversion(uint8_t bitResolution) {
+    switch (bitResolution) {
+    case 9:
+      return 94;
+    case 10:
+      return 188;
+    case 11:
+      return 375;
+    default:
+      return 750;
+    }
+  }
+  int16_t millisToWaitForConversion() {
+    return millisToWaitForConversion(_resolution);
+  }
+  void requestTemperatures();
+  bool requestTemperaturesByAddress(const uint8_t *deviceAddress) {
+    (void)deviceAddress;
+    requestTemperatures();
+    return true;
+  }
+  bool isConversionComplete() {
+    return millis() - _conversionStart >=
+           (unsigned long)millisToWaitForConversion();
+  }
+  float getTempC(const uint8_t *deviceAddress);
+  float getTempF(const uint8_t *deviceAddress) {
+    float c = getTempC(deviceAddress);
+    return c <= DEVICE_DISCONNECTED_C ? DEVICE_DISCONNECTED_F
+                                      : toFahrenheit(c);
+  }
+  float getTempCByIndex(uint8_t index);
+  static float toFahrenheit(float celsius) { return celsius * 1.8f + 32.0f; }
+  static float toCelsius(float fahrenheit) {
+    return (fahrenheit - 32.0f) * 0.555555556f;
+  }
+
+private:
+  OneWire *_wire;                    ///< Bus the probes live on
+  uint8_t _resolution = 12;          ///< Conversion resolution, in bits
+  bool _waitForConversion = true;    ///< True if requestTemperatures() blocks
+  unsigned long _conversionStart = 0; ///< millis() at last conversion start
+};
+
+#endif // WS_NATIVE_DALLASTEMPERATURE_H
@@ -0,0 +1,37 @@
+/*!
+ * @file IPAddress.h
+ *
+ * Host (Linux) stand-in for the Arduino IPAddress type.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_IPADDRESS_H
+#define WS_NATIVE_IPADDRESS_H
+
+#include "Arduino.h"
+
+/** IPv4 address */
+class IPAddress {
+public:
+  IPAddress() : _addr{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+  uint8_t operator[](int index) const { return _addr[index & 3]; }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr[0], _addr[1], _addr[2],
+             _addr[3]);
+    return String(buf);
+  }
+
+private:
+  uint8_t _addr[4]; ///< Address octets
+};
+
+#endif // WS_NATIVE_IPADDRESS_H
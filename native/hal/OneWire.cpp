@@ -0,0 +1,106 @@
+/*!
+ * @file OneWire.cpp
+ *
+ * Host (Linux) stand-in for the OneWire bus driver and DallasTemperature.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "DallasTemperature.h"
+#include <map>
+
+static std::map<uint8_t, std::vector<ws_native_onewire_probe>> _buses;
+
+/****************************************************************************/
+/*!
+    @brief    Attaches a simulated probe to a OneWire pin.
+    @param    pin
+              Bus data pin.
+    @param    rom
+              Probe's 64-bit ROM code.
+    @param    tempC
+              Temperature the probe reports, in Celsius.
+*/
+/****************************************************************************/
+void ws_native_onewire_add(uint8_t pin, const uint8_t rom[8], float tempC) {
+  ws_native_onewire_probe probe;
+  memcpy(probe.rom, rom, 8);
+  probe.tempC = tempC;
+  _buses[pin].push_back(probe);
+}
+
+/****************************************************************************/
+/*!
+    @brief    Returns the probes attached to a OneWire pin.
+    @param    pin
+              Bus data pin.
+    @returns  Probes on the bus, in search order.
+*/
+/****************************************************************************/
+std::vector<ws_native_onewire_probe> &ws_native_onewire_probes(uint8_t pin) {
+  return _buses[pin];
+}
+
+uint8_t OneWire::crc8(const uint8_t *addr, uint8_t len) {
+  uint8_t crc = 0;
+  while (len--) {
+    uint8_t inbyte = *addr++;
+    for (uint8_t i = 8; i; i--) {
+      uint8_t mix = (crc ^ inbyte) & 0x01;
+      crc >>= 1;
+      if (mix)
+        crc ^= 0x8C;
+      inbyte >>= 1;
+    }
+  }
+  return crc;
+}
+
+bool DallasTemperature::getAddress(uint8_t *deviceAddress, uint8_t index) {
+  std::vector<ws_native_onewire_probe> &probes =
+      ws_native_onewire_probes(_wire->getPin());
+  if (index >= probes.size())
+    return false;
+  memcpy(deviceAddress, probes[index].rom, 8);
+  return true;
+}
+
+bool DallasTemperature::isConnected(const uint8_t *deviceAddress) {
+  for (const ws_native_onewire_probe &probe :
+       ws_native_onewire_probes(_wire->getPin())) {
+    if (memcmp(probe.rom, deviceAddress, 8) == 0)
+      return true;
+  }
+  return false;
+}
+
+void DallasTemperature::requestTemperatures() {
+  _wire->reset();
+  _conversionStart = millis();
+  if (_waitForConversion)
+    delay((unsigned long)millisToWaitForConversion());
+}
+
+float DallasTemperature::getTempC(const uint8_t *deviceAddress) {
+  _wire->reset();
+  delayMicroseconds(9 * 8 * 70); // match ROM, read 9 byte scratchpad
+  for (const ws_native_onewire_probe &probe :
+       ws_native_onewire_probes(_wire->getPin())) {
+    if (memcmp(probe.rom, deviceAddress, 8) == 0)
+      return probe.tempC;
+  }
+  return DEVICE_DISCONNECTED_C;
+}
+
+float DallasTemperature::getTempCByIndex(uint8_t index) {
+  DeviceAddress addr;
+  if (!getAddress(addr, index))
+    return DEVICE_DISCONNECTED_C;
+  return getTempC(addr);
+}
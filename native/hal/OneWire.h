@@ -0,0 +1,58 @@
+/*!
+ * @file OneWire.h
+ *
+ * Host (Linux) stand-in for the OneWire bus driver. Probes are attached
+ * to a pin by the harness with ws_native_onewire_add().
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_ONEWIRE_H
+#define WS_NATIVE_ONEWIRE_H
+
+#include "Arduino.h"
+#include <vector>
+
+/** Simulated DS18x20 probe on a OneWire bus */
+struct ws_native_onewire_probe {
+  uint8_t rom[8]; ///< 64-bit ROM code, family code first
+  float tempC;    ///< Temperature the probe reports, in Celsius
+};
+
+void ws_native_onewire_add(uint8_t pin, const uint8_t rom[8], float tempC);
+std::vector<ws_native_onewire_probe> &ws_native_onewire_probes(uint8_t pin);
+
+/** Simulated OneWire bus master */
+class OneWire {
+public:
+  OneWire(uint8_t pin) : _pin(pin) {}
+  uint8_t reset() {
+    delayMicroseconds(960);
+    return ws_native_onewire_probes(_pin).empty() ? 0 : 1;
+  }
+  void reset_search() { _searchIdx = 0; }
+  bool search(uint8_t *newAddr, bool search_mode = true) {
+    (void)search_mode;
+    std::vector<ws_native_onewire_probe> &probes =
+        ws_native_onewire_probes(_pin);
+    if (_searchIdx >= probes.size())
+      return false;
+    delayMicroseconds(64 * 200); // 64 triplets of read, read, write slots
+    memcpy(newAddr, probes[_searchIdx++].rom, 8);
+    return true;
+  }
+  static uint8_t crc8(const uint8_t *addr, uint8_t len);
+  uint8_t getPin() { return _pin; }
+
+private:
+  uint8_t _pin;          ///< Bus data pin
+  size_t _searchIdx = 0; ///< Next probe returned by search()
+};
+
+#endif // WS_NATIVE_ONEWIRE_H
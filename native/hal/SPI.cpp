@@ -0,0 +1,17 @@
+/*!
+ * @file SPI.cpp
+ *
+ * Host (Linux) stand-in for the Arduino SPI driver.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "SPI.h"
+
+SPIClass SPI;
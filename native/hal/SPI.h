@@ -0,0 +1,59 @@
+/*!
+ * @file SPI.h
+ *
+ * Host (Linux) stand-in for the Arduino SPI driver, no targets attached.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_SPI_H
+#define WS_NATIVE_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+/** SPI bus configuration */
+class SPISettings {
+public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST,
+              uint8_t dataMode = SPI_MODE0)
+      : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+  uint32_t clock;   ///< SCK frequency, in Hz
+  uint8_t bitOrder; ///< MSBFIRST or LSBFIRST
+  uint8_t dataMode; ///< SPI_MODEx
+};
+
+/** Simulated SPI controller, reads back 0xFF (floating MISO) */
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  void beginTransaction(SPISettings settings) { (void)settings; }
+  void endTransaction() {}
+  void setBitOrder(uint8_t bitOrder) { (void)bitOrder; }
+  void setDataMode(uint8_t dataMode) { (void)dataMode; }
+  void setClockDivider(uint8_t div) { (void)div; }
+  uint8_t transfer(uint8_t data) {
+    (void)data;
+    return 0xFF;
+  }
+  uint16_t transfer16(uint16_t data) {
+    (void)data;
+    return 0xFFFF;
+  }
+  void transfer(void *buf, size_t count) { memset(buf, 0xFF, count); }
+};
+
+extern SPIClass SPI;
+
+#endif // WS_NATIVE_SPI_H
@@ -0,0 +1,51 @@
+/*!
+ * @file Servo.h
+ *
+ * Host (Linux) stand-in for the Arduino Servo library.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_SERVO_H
+#define WS_NATIVE_SERVO_H
+
+#include "Arduino.h"
+
+/** Simulated hobby servo, records the last pulse width written */
+class Servo {
+public:
+  uint8_t attach(int pin, int min = 544, int max = 2400) {
+    _pin = pin;
+    _min = min;
+    _max = max;
+    return 0;
+  }
+  void detach() { _pin = -1; }
+  void write(int value) {
+    if (value < 200)
+      value = map(constrain(value, 0, 180), 0, 180, _min, _max);
+    writeMicroseconds(value);
+  }
+  void writeMicroseconds(int value) {
+    _us = value;
+    if (_pin >= 0)
+      analogWrite((uint8_t)_pin, value);
+  }
+  int read() { return (int)map(_us, _min, _max, 0, 180); }
+  int readMicroseconds() { return _us; }
+  bool attached() { return _pin >= 0; }
+
+private:
+  int _pin = -1;  ///< Attached pin, -1 if detached
+  int _min = 544; ///< Minimum pulse width, in us
+  int _max = 2400; ///< Maximum pulse width, in us
+  int _us = 0;    ///< Last pulse width written, in us
+};
+
+#endif // WS_NATIVE_SERVO_H
@@ -0,0 +1,11 @@
+/*!
+ * @file Stream.h
+ *
+ * Host (Linux) stand-in, forwards to the native Arduino core.
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "Arduino.h"
@@ -0,0 +1,78 @@
+/*!
+ * @file WiFi.h
+ *
+ * Host (Linux) stand-in for the Arduino WiFi station interface. The link
+ * can be taken down by the harness to exercise the reconnect paths.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_WIFI_H
+#define WS_NATIVE_WIFI_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+/** WiFi link status, matching the Arduino WiFi API */
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+#define WIFI_STA 1 ///< Station mode
+
+/** Simulated WiFi station */
+class WiFiClass {
+public:
+  void mode(int m) { (void)m; }
+  wl_status_t begin(const char *ssid, const char *pass = nullptr) {
+    (void)pass;
+    strncpy(_ssid, ssid ? ssid : "", sizeof(_ssid) - 1);
+    delay(_connectMs);
+    _status = _linkUp ? WL_CONNECTED : WL_CONNECT_FAILED;
+    return _status;
+  }
+  void disconnect() { _status = WL_DISCONNECTED; }
+  wl_status_t status() {
+    if (!_linkUp && _status == WL_CONNECTED)
+      _status = WL_CONNECTION_LOST;
+    return _status;
+  }
+  int8_t scanNetworks() { return 1; }
+  String SSID(uint8_t i = 0) {
+    (void)i;
+    return String(_ssid);
+  }
+  int32_t RSSI(uint8_t i = 0) {
+    (void)i;
+    return -42;
+  }
+  uint8_t *macAddress(uint8_t *mac) {
+    memcpy(mac, _mac, sizeof(_mac));
+    return mac;
+  }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  void ws_native_set_link(bool up) { _linkUp = up; }
+  bool ws_native_link() { return _linkUp; }
+
+private:
+  char _ssid[33] = {0};                 ///< Network joined by begin()
+  uint8_t _mac[6] = {0x02, 0x00, 0x00, 0x12, 0x34, 0x56}; ///< Local MAC
+  wl_status_t _status = WL_IDLE_STATUS; ///< Station status
+  bool _linkUp = true;                  ///< Simulated radio link state
+  unsigned long _connectMs = 100;       ///< Association time, in ms
+};
+
+extern WiFiClass WiFi;
+
+#endif // WS_NATIVE_WIFI_H
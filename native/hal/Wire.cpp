@@ -0,0 +1,94 @@
+/*!
+ * @file Wire.cpp
+ *
+ * Host (Linux) stand-in for the Arduino TwoWire (I2C) driver.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "Wire.h"
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+
+/** Approximate bus time for one byte at the configured clock, in us */
+#define WS_NATIVE_I2C_BYTE_US(clk) (9000000UL / (clk))
+
+void TwoWire::beginTransmission(uint8_t address) {
+  _txAddr = address & 0x7F;
+  _txLen = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  _transactions++;
+  // address byte plus payload
+  delayMicroseconds(WS_NATIVE_I2C_BYTE_US(_clock) * (unsigned int)(_txLen + 1));
+  ws_native_i2c_device *dev = _devices[_txAddr];
+  if (dev == nullptr)
+    return 2; // NACK on address
+  if (_txLen > 0)
+    dev->onWrite(_txBuf, _txLen);
+  _txLen = 0;
+  return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t quantity, bool sendStop) {
+  (void)sendStop;
+  _transactions++;
+  _rxLen = 0;
+  _rxPos = 0;
+  if (quantity > WS_NATIVE_I2C_BUF_SZ)
+    quantity = WS_NATIVE_I2C_BUF_SZ;
+  delayMicroseconds(WS_NATIVE_I2C_BYTE_US(_clock) *
+                    (unsigned int)(quantity + 1));
+  ws_native_i2c_device *dev = _devices[address & 0x7F];
+  if (dev == nullptr)
+    return 0;
+  _rxLen = dev->onRead(_rxBuf, quantity);
+  return _rxLen;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (_txLen >= WS_NATIVE_I2C_BUF_SZ)
+    return 0;
+  _txBuf[_txLen++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+  size_t n = 0;
+  while (n < quantity && write(data[n]))
+    n++;
+  return n;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Attaches a simulated target to the bus.
+    @param    address
+              7-bit I2C address.
+    @param    device
+              Simulated target, owned by the caller.
+*/
+/****************************************************************************/
+void TwoWire::ws_native_attach(uint8_t address, ws_native_i2c_device *device) {
+  _devices[address & 0x7F] = device;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Detaches a simulated target from the bus.
+    @param    address
+              7-bit I2C address.
+*/
+/****************************************************************************/
+void TwoWire::ws_native_detach(uint8_t address) {
+  _devices[address & 0x7F] = nullptr;
+}
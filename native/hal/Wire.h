@@ -0,0 +1,113 @@
+/*!
+ * @file Wire.h
+ *
+ * Host (Linux) stand-in for the Arduino TwoWire (I2C) driver. Addresses
+ * NACK unless the harness attaches a simulated device with
+ * TwoWire::ws_native_attach().
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_WIRE_H
+#define WS_NATIVE_WIRE_H
+
+#include "Arduino.h"
+
+#define WIRE_HAS_END 1         ///< TwoWire::end() is available
+#define WS_NATIVE_I2C_BUF_SZ 256 ///< Size of the TX/RX transaction buffers
+
+/**************************************************************************/
+/*!
+    @brief  Simulated I2C target, attached to a TwoWire bus by address.
+*/
+/**************************************************************************/
+class ws_native_i2c_device {
+public:
+  virtual ~ws_native_i2c_device() {}
+  /*!
+      @brief  Called with the bytes of a completed write transaction.
+      @param  data
+              Bytes written by the controller.
+      @param  len
+              Number of bytes written.
+  */
+  virtual void onWrite(const uint8_t *data, size_t len) = 0;
+  /*!
+      @brief  Called when the controller requests bytes.
+      @param  data
+              Buffer to fill.
+      @param  len
+              Number of bytes requested.
+      @returns Number of bytes provided.
+  */
+  virtual size_t onRead(uint8_t *data, size_t len) = 0;
+};
+
+/**************************************************************************/
+/*!
+    @brief  Simulated I2C controller.
+*/
+/**************************************************************************/
+class TwoWire : public Stream {
+public:
+  TwoWire(uint8_t busNum = 0) : _busNum(busNum) {}
+  bool begin() { return true; }
+  bool begin(int sda, int scl, uint32_t frequency = 0) {
+    (void)sda;
+    (void)scl;
+    if (frequency)
+      _clock = frequency;
+    return true;
+  }
+  void end() {}
+  void setClock(uint32_t frequency) { _clock = frequency; }
+  uint32_t getClock() { return _clock; }
+  void setTimeout(uint16_t timeOutMillis) { (void)timeOutMillis; }
+
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+  uint8_t endTransmission(bool sendStop = true);
+  size_t requestFrom(uint8_t address, size_t quantity, bool sendStop = true);
+  uint8_t requestFrom(int address, int quantity) {
+    return (uint8_t)requestFrom((uint8_t)address, (size_t)quantity, true);
+  }
+  uint8_t requestFrom(int address, int quantity, int sendStop) {
+    return (uint8_t)requestFrom((uint8_t)address, (size_t)quantity,
+                                sendStop != 0);
+  }
+
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t *data, size_t quantity) override;
+  using Print::write;
+  int available() override { return (int)(_rxLen - _rxPos); }
+  int read() override { return _rxPos < _rxLen ? _rxBuf[_rxPos++] : -1; }
+  int peek() override { return _rxPos < _rxLen ? _rxBuf[_rxPos] : -1; }
+  void flush() override {}
+
+  void ws_native_attach(uint8_t address, ws_native_i2c_device *device);
+  void ws_native_detach(uint8_t address);
+  uint32_t ws_native_transactions() { return _transactions; }
+
+private:
+  uint8_t _busNum;                         ///< Bus index
+  uint32_t _clock = 100000;                ///< SCL frequency, in Hz
+  uint8_t _txAddr = 0;                     ///< Address of open write
+  uint8_t _txBuf[WS_NATIVE_I2C_BUF_SZ];    ///< Pending write bytes
+  size_t _txLen = 0;                       ///< Number of pending write bytes
+  uint8_t _rxBuf[WS_NATIVE_I2C_BUF_SZ];    ///< Bytes returned by the target
+  size_t _rxLen = 0;                       ///< Number of bytes in _rxBuf
+  size_t _rxPos = 0;                       ///< Read position in _rxBuf
+  ws_native_i2c_device *_devices[128] = {}; ///< Attached targets, by address
+  uint32_t _transactions = 0;              ///< Count of bus transactions
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif // WS_NATIVE_WIRE_H
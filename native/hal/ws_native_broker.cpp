@@ -0,0 +1,311 @@
+/*!
+ * @file ws_native_broker.cpp
+ *
+ * In-process MQTT 3.1.1 broker for the host (Linux) build.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_native_broker.h"
+#include "WiFi.h"
+
+ws_native_broker WS_NATIVE_BROKER;
+
+// MQTT control packet types
+#define MQTT_CONNECT 1
+#define MQTT_CONNACK 2
+#define MQTT_PUBLISH 3
+#define MQTT_PUBACK 4
+#define MQTT_SUBSCRIBE 8
+#define MQTT_SUBACK 9
+#define MQTT_UNSUBSCRIBE 10
+#define MQTT_UNSUBACK 11
+#define MQTT_PINGREQ 12
+#define MQTT_PINGRESP 13
+#define MQTT_DISCONNECT 14
+
+int ws_native_broker::connect(IPAddress ip, uint16_t port) {
+  (void)ip;
+  return connect("localhost", port);
+}
+
+int ws_native_broker::connect(const char *host, uint16_t port) {
+  (void)host;
+  (void)port;
+  if (!WiFi.ws_native_link())
+    return 0;
+  _in.clear();
+  _out.clear();
+  _subs.clear();
+  _connected = true;
+  return 1;
+}
+
+void ws_native_broker::stop() {
+  _connected = false;
+  _in.clear();
+  _out.clear();
+}
+
+int ws_native_broker::read() {
+  if (_out.empty())
+    return -1;
+  uint8_t b = _out.front();
+  _out.pop_front();
+  return b;
+}
+
+int ws_native_broker::read(uint8_t *buf, size_t size) {
+  size_t n = 0;
+  while (n < size && !_out.empty()) {
+    buf[n++] = _out.front();
+    _out.pop_front();
+  }
+  return (int)n;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Receives bytes from the client and dispatches every complete
+              MQTT control packet.
+    @param    buf
+              Bytes sent by the client.
+    @param    size
+              Number of bytes.
+    @returns  Number of bytes accepted, 0 if the link is down.
+*/
+/****************************************************************************/
+size_t ws_native_broker::write(const uint8_t *buf, size_t size) {
+  if (!_connected || !WiFi.ws_native_link()) {
+    _connected = false;
+    return 0;
+  }
+  _bytesIn += size;
+  _in.insert(_in.end(), buf, buf + size);
+
+  // Parse as many complete packets as are buffered
+  for (;;) {
+    if (_in.size() < 2)
+      break;
+    size_t remaining = 0, pos = 1;
+    uint32_t multiplier = 1;
+    bool complete = false;
+    while (pos < _in.size() && pos < 5) {
+      uint8_t encoded = _in[pos++];
+      remaining += (encoded & 0x7F) * multiplier;
+      multiplier *= 128;
+      if ((encoded & 0x80) == 0) {
+        complete = true;
+        break;
+      }
+    }
+    if (!complete || _in.size() < pos + remaining)
+      break;
+    std::vector<uint8_t> packet(_in.begin(), _in.begin() + pos + remaining);
+    _in.erase(_in.begin(), _in.begin() + pos + remaining);
+    processPacket(packet[0], packet.data() + pos, remaining);
+  }
+  return size;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Handles one MQTT control packet from the client.
+    @param    header
+              Fixed header byte, packet type and flags.
+    @param    body
+              Variable header and payload.
+    @param    len
+              Length of body, in bytes.
+*/
+/****************************************************************************/
+void ws_native_broker::processPacket(uint8_t header, const uint8_t *body,
+                                     size_t len) {
+  switch (header >> 4) {
+  case MQTT_CONNECT: {
+    const uint8_t connack[] = {0x00, 0x00};
+    delay(_rttMs);
+    queuePacket(MQTT_CONNACK << 4, connack, sizeof(connack));
+    break;
+  }
+  case MQTT_PUBLISH: {
+    uint8_t qos = (header >> 1) & 0x03;
+    if (len < 2)
+      return;
+    size_t topicLen = ((size_t)body[0] << 8) | body[1];
+    if (len < 2 + topicLen)
+      return;
+    std::string topic((const char *)body + 2, topicLen);
+    size_t offset = 2 + topicLen;
+    if (qos > 0) {
+      const uint8_t puback[] = {body[offset], body[offset + 1]};
+      offset += 2;
+      delay(_rttMs);
+      queuePacket(MQTT_PUBACK << 4, puback, sizeof(puback));
+    }
+    _publishesIn++;
+    // Loop back to matching subscriptions, then let the harness respond
+    for (const std::string &filter : _subs) {
+      if (topicMatches(filter.c_str(), topic.c_str())) {
+        deliver(topic.c_str(), body + offset, len - offset);
+        break;
+      }
+    }
+    if (_onPublish != nullptr)
+      _onPublish(topic.c_str(), body + offset, len - offset);
+    break;
+  }
+  case MQTT_SUBSCRIBE: {
+    if (len < 2)
+      return;
+    std::vector<uint8_t> suback = {body[0], body[1]};
+    size_t offset = 2;
+    while (offset + 2 <= len) {
+      size_t topicLen = ((size_t)body[offset] << 8) | body[offset + 1];
+      offset += 2;
+      if (offset + topicLen + 1 > len)
+        break;
+      _subs.push_back(std::string((const char *)body + offset, topicLen));
+      offset += topicLen;
+      suback.push_back(body[offset++] & 0x01); // grant QoS 0 or 1
+    }
+    delay(_rttMs);
+    queuePacket(MQTT_SUBACK << 4, suback.data(), suback.size());
+    break;
+  }
+  case MQTT_UNSUBSCRIBE: {
+    if (len < 2)
+      return;
+    size_t offset = 2;
+    while (offset + 2 <= len) {
+      size_t topicLen = ((size_t)body[offset] << 8) | body[offset + 1];
+      offset += 2;
+      if (offset + topicLen > len)
+        break;
+      std::string filter((const char *)body + offset, topicLen);
+      _subs.erase(std::remove(_subs.begin(), _subs.end(), filter),
+                  _subs.end());
+      offset += topicLen;
+    }
+    const uint8_t unsuback[] = {body[0], body[1]};
+    delay(_rttMs);
+    queuePacket(MQTT_UNSUBACK << 4, unsuback, sizeof(unsuback));
+    break;
+  }
+  case MQTT_PINGREQ:
+    delay(_rttMs);
+    queuePacket(MQTT_PINGRESP << 4, nullptr, 0);
+    break;
+  case MQTT_DISCONNECT:
+    _connected = false;
+    break;
+  default: // PUBACK and friends need no response
+    break;
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Frames a control packet and queues it for the client.
+    @param    header
+              Fixed header byte, packet type and flags.
+    @param    body
+              Variable header and payload.
+    @param    len
+              Length of body, in bytes.
+*/
+/****************************************************************************/
+void ws_native_broker::queuePacket(uint8_t header, const uint8_t *body,
+                                   size_t len) {
+  _out.push_back(header);
+  size_t remaining = len;
+  do {
+    uint8_t encoded = remaining % 128;
+    remaining /= 128;
+    if (remaining > 0)
+      encoded |= 0x80;
+    _out.push_back(encoded);
+  } while (remaining > 0);
+  if (len > 0)
+    _out.insert(_out.end(), body, body + len);
+}
+
+/****************************************************************************/
+/*!
+    @brief    Delivers a QoS 0 PUBLISH to the client, as if another MQTT
+              client had published it.
+    @param    topic
+              Topic to publish on.
+    @param    payload
+              Message payload.
+    @param    len
+              Length of payload, in bytes.
+*/
+/****************************************************************************/
+void ws_native_broker::deliver(const char *topic, const uint8_t *payload,
+                               size_t len) {
+  if (!_connected)
+    return;
+  size_t topicLen = strlen(topic);
+  std::vector<uint8_t> body;
+  body.reserve(2 + topicLen + len);
+  body.push_back((uint8_t)(topicLen >> 8));
+  body.push_back((uint8_t)topicLen);
+  body.insert(body.end(), topic, topic + topicLen);
+  body.insert(body.end(), payload, payload + len);
+  queuePacket(MQTT_PUBLISH << 4, body.data(), body.size());
+  _publishesOut++;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Finds an active subscription ending with the given suffix.
+    @param    suffix
+              Topic suffix, such as "/signals/broker".
+    @returns  Topic filter, or nullptr if the client is not subscribed.
+*/
+/****************************************************************************/
+const char *ws_native_broker::findSubscription(const char *suffix) {
+  size_t suffixLen = strlen(suffix);
+  for (const std::string &filter : _subs) {
+    if (filter.length() >= suffixLen &&
+        filter.compare(filter.length() - suffixLen, suffixLen, suffix) == 0)
+      return filter.c_str();
+  }
+  return nullptr;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Matches a topic against an MQTT topic filter.
+    @param    filter
+              Topic filter, may contain '+' and '#' wildcards.
+    @param    topic
+              Topic name.
+    @returns  True if the topic matches the filter.
+*/
+/****************************************************************************/
+bool ws_native_broker::topicMatches(const char *filter, const char *topic) {
+  while (*filter && *topic) {
+    if (*filter == '#')
+      return true;
+    if (*filter == '+') {
+      while (*topic && *topic != '/')
+        topic++;
+      filter++;
+      continue;
+    }
+    if (*filter != *topic)
+      return false;
+    filter++;
+    topic++;
+  }
+  return (*filter == '\0' && *topic == '\0') || strcmp(filter, "#") == 0 ||
+         strcmp(filter, "/#") == 0;
+}
@@ -0,0 +1,78 @@
+/*!
+ * @file ws_native_broker.h
+ *
+ * In-process MQTT 3.1.1 broker for the host (Linux) build. It implements
+ * the Arduino Client interface, so the real Adafruit_MQTT_Client talks to
+ * it exactly as it would talk to a TCP socket, and loops publishes back to
+ * matching subscriptions. A publish handler lets the harness play the role
+ * of Adafruit IO.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_BROKER_H
+#define WS_NATIVE_BROKER_H
+
+#include "Client.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+/** Called for every PUBLISH the device sends to the broker */
+typedef void (*ws_native_publish_cb)(const char *topic, const uint8_t *payload,
+                                     size_t len);
+
+/**************************************************************************/
+/*!
+    @brief  Loopback MQTT broker, seen by the firmware as a network Client.
+*/
+/**************************************************************************/
+class ws_native_broker : public Client {
+public:
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char *host, uint16_t port) override;
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t *buf, size_t size) override;
+  int available() override { return (int)_out.size(); }
+  int read() override;
+  int read(uint8_t *buf, size_t size) override;
+  int peek() override { return _out.empty() ? -1 : _out.front(); }
+  void flush() override {}
+  void stop() override;
+  uint8_t connected() override { return _connected ? 1 : 0; }
+  operator bool() override { return _connected; }
+
+  void setPublishHandler(ws_native_publish_cb cb) { _onPublish = cb; }
+  void setRoundTripMs(uint32_t ms) { _rttMs = ms; }
+  void deliver(const char *topic, const uint8_t *payload, size_t len);
+  const char *findSubscription(const char *suffix);
+  static bool topicMatches(const char *filter, const char *topic);
+
+  uint32_t publishesIn() { return _publishesIn; }   ///< Device->broker count
+  uint32_t publishesOut() { return _publishesOut; } ///< Broker->device count
+  uint64_t bytesIn() { return _bytesIn; }           ///< Device->broker bytes
+
+private:
+  void processPacket(uint8_t header, const uint8_t *body, size_t len);
+  void queuePacket(uint8_t header, const uint8_t *body, size_t len);
+
+  bool _connected = false;                ///< True while a session is open
+  std::vector<uint8_t> _in;               ///< Partially received packet bytes
+  std::deque<uint8_t> _out;               ///< Bytes waiting for the client
+  std::vector<std::string> _subs;         ///< Active topic filters
+  ws_native_publish_cb _onPublish = nullptr; ///< Harness publish handler
+  uint32_t _rttMs = 0;                    ///< Simulated round trip time, ms
+  uint32_t _publishesIn = 0;              ///< PUBLISH packets received
+  uint32_t _publishesOut = 0;             ///< PUBLISH packets delivered
+  uint64_t _bytesIn = 0;                  ///< Total bytes received
+};
+
+extern ws_native_broker WS_NATIVE_BROKER;
+
+#endif // WS_NATIVE_BROKER_H
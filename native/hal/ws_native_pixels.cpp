@@ -0,0 +1,70 @@
+/*!
+ * @file ws_native_pixels.cpp
+ *
+ * Frame buffer shared by the host (Linux) NeoPixel and DotStar stand-ins.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_native_pixels.h"
+
+/****************************************************************************/
+/*!
+    @brief    Converts hue, saturation and value into a packed RGB color,
+              matching Adafruit_NeoPixel::ColorHSV().
+    @param    hue
+              Hue, 0 to 65535 is one full turn of the color wheel.
+    @param    sat
+              Saturation, 0 (grayscale) to 255 (full).
+    @param    val
+              Value, 0 (off) to 255 (full).
+    @returns  Packed 0x00RRGGBB color.
+*/
+/****************************************************************************/
+uint32_t ws_native_pixels::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
+  uint8_t r, g, b;
+  hue = (uint16_t)((hue * 1530L + 32768) / 65536);
+  if (hue < 510) { // Red to Green-1
+    b = 0;
+    if (hue < 255) { //   Red to Yellow-1
+      r = 255;
+      g = (uint8_t)hue;
+    } else { //   Yellow to Green-1
+      r = (uint8_t)(510 - hue);
+      g = 255;
+    }
+  } else if (hue < 1020) { // Green to Blue-1
+    r = 0;
+    if (hue < 765) { //   Green to Cyan-1
+      g = 255;
+      b = (uint8_t)(hue - 510);
+    } else { //   Cyan to Blue-1
+      g = (uint8_t)(1020 - hue);
+      b = 255;
+    }
+  } else if (hue < 1530) { // Blue to Red-1
+    g = 0;
+    if (hue < 1275) { //   Blue to Magenta-1
+      r = (uint8_t)(hue - 1020);
+      b = 255;
+    } else { //   Magenta to Red-1
+      r = 255;
+      b = (uint8_t)(1530 - hue);
+    }
+  } else { // Last 0.5 Red
+    r = 255;
+    g = b = 0;
+  }
+  uint32_t v1 = 1 + val;
+  uint16_t s1 = (uint16_t)(1 + sat);
+  uint8_t s2 = (uint8_t)(255 - sat);
+  return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+         (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+         (((((b * s1) >> 8) + s2) * v1) >> 8);
+}
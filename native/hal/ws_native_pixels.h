@@ -0,0 +1,93 @@
+/*!
+ * @file ws_native_pixels.h
+ *
+ * Frame buffer shared by the host (Linux) NeoPixel and DotStar stand-ins.
+ * Colors are kept in memory so the harness can inspect what the firmware
+ * rendered, and show() advances the virtual clock by the wire time.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_NATIVE_PIXELS_H
+#define WS_NATIVE_PIXELS_H
+
+#include "Arduino.h"
+#include <vector>
+
+/** In-memory addressable LED strand */
+class ws_native_pixels {
+public:
+  ws_native_pixels(uint16_t n, int16_t pin, uint32_t usPerPixel)
+      : _pixels(n, 0), _pin(pin), _usPerPixel(usPerPixel) {}
+  virtual ~ws_native_pixels() {}
+
+  void begin() {}
+  void show() {
+    _shows++;
+    delayMicroseconds((unsigned int)(_usPerPixel * _pixels.size()));
+  }
+  void clear() { std::fill(_pixels.begin(), _pixels.end(), 0); }
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0) {
+    if (first >= _pixels.size())
+      return;
+    uint16_t end = (count == 0 || first + count > _pixels.size())
+                       ? (uint16_t)_pixels.size()
+                       : (uint16_t)(first + count);
+    for (uint16_t i = first; i < end; i++)
+      _pixels[i] = c;
+  }
+  void setPixelColor(uint16_t n, uint32_t c) {
+    if (n < _pixels.size())
+      _pixels[n] = c;
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, Color(r, g, b));
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    setPixelColor(n, Color(r, g, b, w));
+  }
+  uint32_t getPixelColor(uint16_t n) const {
+    return n < _pixels.size() ? _pixels[n] : 0;
+  }
+  void setBrightness(uint8_t b) { _brightness = b; }
+  uint8_t getBrightness() const { return _brightness; }
+  uint16_t numPixels() const { return (uint16_t)_pixels.size(); }
+  int16_t getPin() const { return _pin; }
+  uint32_t ws_native_shows() const { return _shows; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    return ((uint32_t)w << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+  static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255,
+                           uint8_t val = 255);
+  static uint8_t sine8(uint8_t x) {
+    return (uint8_t)lround(127.5 + 127.5 * sin(x * TWO_PI / 256.0));
+  }
+  static uint8_t gamma8(uint8_t x) {
+    return (uint8_t)lround(pow(x / 255.0, 2.6) * 255.0);
+  }
+  static uint32_t gamma32(uint32_t x) {
+    uint8_t *y = (uint8_t *)&x;
+    for (uint8_t i = 0; i < 4; i++)
+      y[i] = gamma8(y[i]);
+    return x;
+  }
+
+protected:
+  std::vector<uint32_t> _pixels; ///< Packed 0xWWRRGGBB colors
+  int16_t _pin;                  ///< Data pin
+  uint32_t _usPerPixel;          ///< Wire time per pixel, in microseconds
+  uint8_t _brightness = 0;       ///< Last value passed to setBrightness()
+  uint32_t _shows = 0;           ///< Number of calls to show()
+};
+
+#endif // WS_NATIVE_PIXELS_H
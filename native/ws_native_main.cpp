@@ -0,0 +1,170 @@
+/*!
+ * @file ws_native_main.cpp
+ *
+ * Entry point for the host (Linux) build of Adafruit IO WipperSnapper.
+ * Provisions and connects the firmware against the loopback broker, with
+ * this file standing in for Adafruit IO during registration, then times
+ * Wippersnapper::run() over a fixed number of loop passes.
+ *
+ * Usage: program [--iterations N] [--tick-ms MS] [--rtt-ms MS]
+ *                [--numeric-pin-events] [--pin-event-batches]
+ *                [--ds18x20-sensor-addresses] [--verbose]
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "Wippersnapper_Networking.h"
+#include "ws_native_broker.h"
+#include <chrono>
+
+Wippersnapper_WiFi wipper;
+
+#define WS_NATIVE_TOTAL_GPIO_PINS 20  ///< GPIO pins reported at registration
+#define WS_NATIVE_TOTAL_ANALOG_PINS 6 ///< Analog pins reported at registration
+#define WS_NATIVE_AREF 3.3            ///< Reference voltage, in volts
+
+static bool _numericPinEvents = false;       ///< Advertised at registration
+static bool _pinEventBatches = false;        ///< Advertised at registration
+static bool _ds18x20SensorAddresses = false; ///< Advertised at registration
+
+/****************************************************************************/
+/*!
+    @brief    Checks if a string ends with the given suffix.
+    @param    str
+              String to check.
+    @param    suffix
+              Expected suffix.
+    @returns  True if str ends with suffix.
+*/
+/****************************************************************************/
+static bool endsWith(const char *str, const char *suffix) {
+  size_t strLen = strlen(str), suffixLen = strlen(suffix);
+  return strLen >= suffixLen &&
+         strcmp(str + strLen - suffixLen, suffix) == 0;
+}
+
+/****************************************************************************/
+/*!
+    @brief    Plays the part of Adafruit IO during registration: answers the
+              description request and sends an empty initial pin
+              configuration once the device reports registration complete.
+    @param    topic
+              Topic the device published to.
+    @param    payload
+              Encoded message.
+    @param    len
+              Length of payload, in bytes.
+*/
+/****************************************************************************/
+static void ioPublishHandler(const char *topic, const uint8_t *payload,
+                             size_t len) {
+  (void)payload;
+  (void)len;
+  uint8_t buf[128];
+  pb_ostream_t stream = pb_ostream_from_buffer(buf, sizeof(buf));
+
+  if (endsWith(topic, "/wprsnpr/info/status")) {
+    const char *respTopic = WS_NATIVE_BROKER.findSubscription("/info/status");
+    if (respTopic == nullptr)
+      return;
+    wippersnapper_description_v1_CreateDescriptionResponse msg =
+        wippersnapper_description_v1_CreateDescriptionResponse_init_zero;
+    msg.response =
+        wippersnapper_description_v1_CreateDescriptionResponse_Response_RESPONSE_OK;
+    msg.total_gpio_pins = WS_NATIVE_TOTAL_GPIO_PINS;
+    msg.total_analog_pins = WS_NATIVE_TOTAL_ANALOG_PINS;
+    msg.reference_voltage = WS_NATIVE_AREF;
+    msg.total_i2c_ports = 1;
+    msg.numeric_pin_events = _numericPinEvents;
+    msg.pin_event_batches = _pinEventBatches;
+    msg.ds18x20_sensor_addresses = _ds18x20SensorAddresses;
+    if (pb_encode(&stream,
+                  wippersnapper_description_v1_CreateDescriptionResponse_fields,
+                  &msg))
+      WS_NATIVE_BROKER.deliver(respTopic, buf, stream.bytes_written);
+  } else if (endsWith(topic, "/info/status/device/complete")) {
+    const char *sigTopic =
+        WS_NATIVE_BROKER.findSubscription("/signals/broker");
+    if (sigTopic == nullptr)
+      return;
+    wippersnapper_signal_v1_CreateSignalRequest msg =
+        wippersnapper_signal_v1_CreateSignalRequest_init_zero;
+    msg.which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_configs_tag;
+    if (pb_encode(&stream, wippersnapper_signal_v1_CreateSignalRequest_fields,
+                  &msg))
+      WS_NATIVE_BROKER.deliver(sigTopic, buf, stream.bytes_written);
+  }
+}
+
+int main(int argc, char **argv) {
+  long iterations = 1000;
+  long tickMs = 10;
+  bool verbose = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+      iterations = atol(argv[++i]);
+    else if (strcmp(argv[i], "--tick-ms") == 0 && i + 1 < argc)
+      tickMs = atol(argv[++i]);
+    else if (strcmp(argv[i], "--rtt-ms") == 0 && i + 1 < argc)
+      WS_NATIVE_BROKER.setRoundTripMs((uint32_t)atol(argv[++i]));
+    else if (strcmp(argv[i], "--numeric-pin-events") == 0)
+      _numericPinEvents = true;
+    else if (strcmp(argv[i], "--pin-event-batches") == 0)
+      _pinEventBatches = true;
+    else if (strcmp(argv[i], "--ds18x20-sensor-addresses") == 0)
+      _ds18x20SensorAddresses = true;
+    else if (strcmp(argv[i], "--verbose") == 0)
+      verbose = true;
+  }
+
+  WS_NATIVE_BROKER.setPublishHandler(ioPublishHandler);
+  Serial.ws_native_mute(!verbose);
+
+  // Mirrors setup() in Wippersnapper_demo.ino
+  wipper.provision();
+  Serial.begin(115200);
+  wipper.connect();
+
+  // Time the application loop, in host nanoseconds
+  uint64_t totalNs = 0, maxNs = 0;
+  uint64_t virtStartUs = ws_native_now_us();
+  for (long i = 0; i < iterations; i++) {
+    auto start = std::chrono::steady_clock::now();
+    wipper.run();
+    uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+    totalNs += ns;
+    if (ns > maxNs)
+      maxNs = ns;
+    ws_native_advance_us((uint64_t)tickMs * 1000ULL);
+  }
+
+  Serial.ws_native_mute(false);
+  Serial.printf("run() iterations: %ld\n", iterations);
+  Serial.printf("run() host time: mean %.0f ns, max %llu ns\n",
+                iterations ? (double)totalNs / iterations : 0.0,
+                (unsigned long long)maxNs);
+  Serial.printf("virtual time elapsed: %llu ms\n",
+                (unsigned long long)((ws_native_now_us() - virtStartUs) /
+                                     1000ULL));
+  Serial.printf("MQTT publishes: %u sent, %u received, %llu bytes sent\n",
+                WS_NATIVE_BROKER.publishesIn(), WS_NATIVE_BROKER.publishesOut(),
+                (unsigned long long)WS_NATIVE_BROKER.bytesIn());
+  Serial.printf("publish queue: %u pending, %u coalesced, %u dropped, "
+                "%u spooled\n",
+                WS._publishQueue->size(), WS._publishQueue->coalesced(),
+                WS._publishQueue->dropped(), WS._publishQueue->spooled());
+  if (WS._offlineLog != nullptr)
+    Serial.printf("offline log: %u pending, %u dropped\n",
+                  WS._offlineLog->size(), WS._offlineLog->dropped());
+  Serial.flush();
+  return 0;
+}
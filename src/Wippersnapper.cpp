@@ -69,6 +69,15 @@ Wippersnapper::Wippersnapper() {
 
   // DallasSemi (OneWire)
   WS._ds18x20Component = new ws_ds18x20();
+
+  // Addressable pixel strands
+  WS._ws_pixelsComponent = new ws_pixels();
+
+  // Application loop scheduler
+  WS._scheduler = new ws_scheduler();
+
+  // Outbound messages from components, published by run()
+  WS._publishQueue = new ws_publish_queue();
 };
 
 /**************************************************************************/
@@ -105,6 +114,13 @@ void Wippersnapper::provision() {
   _littleFS = new WipperSnapper_LittleFS();
 #endif
 
+#ifdef WS_USE_OFFLINE_LOG
+  // Spool outbound messages to the filesystem while offline
+  WS._offlineLog = new ws_offline_log();
+  if (WS._offlineLog->begin())
+    WS._publishQueue->setOfflineLog(WS._offlineLog);
+#endif
+
 #ifdef USE_DISPLAY
   // Initialize the display
   displayConfig config;
@@ -491,14 +507,18 @@ bool cbSignalMsg(pb_istream_t *stream, const pb_field_t *field, void **arg) {
 /**************************************************************************/
 /*!
     @brief    Decodes a signal buffer protobuf message.
-        NOTE: Should be executed in-order after a new _buffer is recieved.
     @param    encodedSignalMsg
               Encoded signal message.
+    @param    buffer
+              Encoded message, as received from the MQTT client.
+    @param    len
+              Length of buffer, in bytes.
     @return   true if successfully decoded signal message, false otherwise.
 */
 /**************************************************************************/
 bool Wippersnapper::decodeSignalMsg(
-    wippersnapper_signal_v1_CreateSignalRequest *encodedSignalMsg) {
+    wippersnapper_signal_v1_CreateSignalRequest *encodedSignalMsg,
+    const pb_byte_t *buffer, size_t len) {
   bool is_success = true;
   WS_DEBUG_PRINTLN("decodeSignalMsg");
 
@@ -507,7 +527,7 @@ bool Wippersnapper::decodeSignalMsg(
   encodedSignalMsg->cb_payload.funcs.decode = cbSignalMsg;
 
   // decode the CreateSignalRequest, calls cbSignalMessage and assoc. callbacks
-  pb_istream_t stream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t stream = pb_istream_from_buffer(buffer, len);
   if (!ws_pb_decode(&stream, wippersnapper_signal_v1_CreateSignalRequest_fields,
                     encodedSignalMsg)) {
     WS_DEBUG_PRINTLN(
@@ -519,8 +539,8 @@ bool Wippersnapper::decodeSignalMsg(
 
 /**************************************************************************/
 /*!
-    @brief    Called when signal topic receives a new message. Fills
-                shared buffer with data from payload.
+    @brief    Called when signal topic receives a new message and
+                decodes it in place from the MQTT client's buffer.
     @param    data
                 Data from MQTT broker.
     @param    len
@@ -531,58 +551,44 @@ void cbSignalTopic(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("cbSignalTopic: New Msg on Signal Topic");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy data to buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Empty struct for storing the signal message
   WS._incomingSignalMsg = wippersnapper_signal_v1_CreateSignalRequest_init_zero;
 
   // Attempt to decode a signal message
-  if (!WS.decodeSignalMsg(&WS._incomingSignalMsg)) {
+  if (!WS.decodeSignalMsg(&WS._incomingSignalMsg, (pb_byte_t *)data, len)) {
     WS_DEBUG_PRINTLN("ERROR: Failed to decode signal message");
   }
+  // Pin configuration may have changed, re-evaluate the pin deadlines
+  WS._scheduler->wake(WS_TASK_DIGITAL_IN);
+  WS._scheduler->wake(WS_TASK_ANALOG_IN);
 }
 
 /******************************************************************************************/
 /*!
-    @brief    Publishes an I2C response signal message to the broker.
+    @brief    Encodes an I2C response signal message and queues it for
+              publishing to the broker.
     @param    msgi2cResponse
               A pointer to an I2C response message typedef.
-*/
-/******************************************************************************************/
-void publishI2CResponse(wippersnapper_signal_v1_I2CResponse *msgi2cResponse) {
-  size_t msgSz;
-  pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_I2CResponse_fields,
-                      msgi2cResponse);
-  WS_DEBUG_PRINT("Publishing Message: I2CResponse...");
-  if (!WS._mqtt->publish(WS._topic_signal_i2c_device, WS._buffer_outgoing,
-                         msgSz, 1)) {
-    WS_DEBUG_PRINTLN("ERROR: Failed to publish I2C Response!");
-  } else {
-    WS_DEBUG_PRINTLN("Published!");
-  }
-}
-
-/******************************************************************************************/
-/*!
-    @brief    Encodes an wippersnapper_signal_v1_I2CResponse message.
-    @param    msgi2cResponse
-              A pointer to an wippersnapper_signal_v1_I2CResponse.
     @return   True if encoded successfully, False otherwise.
 */
 /******************************************************************************************/
-bool encodeI2CResponse(wippersnapper_signal_v1_I2CResponse *msgi2cResponse) {
-  memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-  pb_ostream_t ostream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_I2CResponse_fields,
-                    msgi2cResponse)) {
+bool publishI2CResponse(wippersnapper_signal_v1_I2CResponse *msgi2cResponse) {
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_I2CResponse_fields, msgi2cResponse);
+  if (msgSz == 0) {
     WS_DEBUG_PRINTLN("ERROR: Unable to encode I2C response message!");
     return false;
   }
+  // Queued rather than published here, a blocking publish would let the
+  // MQTT client overwrite the request still being decoded
+  WS_DEBUG_PRINT("Queueing Message: I2CResponse...");
+  if (!WS._publishQueue->enqueue(WS._topic_signal_i2c_device,
+                                 WS._buffer_outgoing, msgSz, 1)) {
+    WS_DEBUG_PRINTLN("ERROR: Failed to queue I2C Response!");
+  } else {
+    WS_DEBUG_PRINTLN("Queued!");
+  }
   return true;
 }
 
@@ -642,12 +648,7 @@ bool cbDecodeI2CDeviceInitRequestList(pb_istream_t *stream,
     WS_DEBUG_PRINTLN("ERROR: Failed to initialize I2C Bus");
     msgi2cResponse.payload.resp_i2c_device_init.bus_response =
         WS._i2cPort0->getBusStatus();
-    if (!encodeI2CResponse(&msgi2cResponse)) {
-      WS_DEBUG_PRINTLN("ERROR: encoding I2C Response!");
-      return false;
-    }
-    publishI2CResponse(&msgi2cResponse);
-    return true;
+    return publishI2CResponse(&msgi2cResponse);
   }
 
   WS._i2cPort0->initI2CDevice(&msgI2CDeviceInitRequest);
@@ -659,14 +660,8 @@ bool cbDecodeI2CDeviceInitRequestList(pb_istream_t *stream,
   msgi2cResponse.payload.resp_i2c_device_init.bus_response =
       WS._i2cPort0->getBusStatus();
 
-  // Encode response
-  if (!encodeI2CResponse(&msgi2cResponse)) {
-    return false;
-  }
-
   // Publish a response for the I2C device
-  publishI2CResponse(&msgi2cResponse);
-  return true;
+  return publishI2CResponse(&msgi2cResponse);
 }
 
 /******************************************************************************************/
@@ -714,12 +709,7 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
       WS_DEBUG_PRINTLN("ERROR: Failed to initialize I2C Bus");
       msgi2cResponse.payload.resp_i2c_scan.bus_response =
           WS._i2cPort0->getBusStatus();
-      if (!encodeI2CResponse(&msgi2cResponse)) {
-        WS_DEBUG_PRINTLN("ERROR: encoding I2C Response!");
-        return false;
-      }
-      publishI2CResponse(&msgi2cResponse);
-      return true;
+      return publishI2CResponse(&msgi2cResponse);
     }
 
     // Scan I2C bus
@@ -734,10 +724,6 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
         scanResp.addresses_found_count;
 
     msgi2cResponse.payload.resp_i2c_scan.bus_response = scanResp.bus_response;
-    // Encode I2CResponse
-    if (!encodeI2CResponse(&msgi2cResponse)) {
-      return false;
-    }
   } else if (
       field->tag ==
       wippersnapper_signal_v1_I2CRequest_req_i2c_device_init_requests_tag) {
@@ -783,12 +769,7 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
       WS_DEBUG_PRINTLN("ERROR: Failed to initialize I2C Bus");
       msgi2cResponse.payload.resp_i2c_device_init.bus_response =
           WS._i2cPort0->getBusStatus();
-      if (!encodeI2CResponse(&msgi2cResponse)) {
-        WS_DEBUG_PRINTLN("ERROR: encoding I2C Response!");
-        return false;
-      }
-      publishI2CResponse(&msgi2cResponse);
-      return true;
+      return publishI2CResponse(&msgi2cResponse);
     }
 
     // Initialize I2C device
@@ -799,11 +780,6 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
         msgI2CDeviceInitRequest.i2c_device_address;
     msgi2cResponse.payload.resp_i2c_device_init.bus_response =
         WS._i2cPort0->getBusStatus();
-
-    // Encode response
-    if (!encodeI2CResponse(&msgi2cResponse)) {
-      return false;
-    }
   } else if (field->tag ==
              wippersnapper_signal_v1_I2CRequest_req_i2c_device_update_tag) {
     WS_DEBUG_PRINTLN("=> INCOMING REQUEST: I2CDeviceUpdateRequest");
@@ -834,11 +810,6 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
         msgI2CDeviceUpdateRequest.i2c_device_address;
     msgi2cResponse.payload.resp_i2c_device_update.bus_response =
         WS._i2cPort0->getBusStatus();
-
-    // Encode response
-    if (!encodeI2CResponse(&msgi2cResponse)) {
-      return false;
-    }
   } else if (field->tag ==
              wippersnapper_signal_v1_I2CRequest_req_i2c_device_deinit_tag) {
     WS_DEBUG_PRINTLN("NEW COMMAND: I2C Device Deinit");
@@ -866,17 +837,13 @@ bool cbDecodeSignalRequestI2C(pb_istream_t *stream, const pb_field_t *field,
         msgI2CDeviceDeinitRequest.i2c_device_address;
     msgi2cResponse.payload.resp_i2c_device_deinit.bus_response =
         WS._i2cPort0->getBusStatus();
-
-    // Encode response
-    if (!encodeI2CResponse(&msgi2cResponse)) {
-      return false;
-    }
   } else {
     WS_DEBUG_PRINTLN("ERROR: Undefined I2C message tag");
     return false; // fail out, we didn't encode anything to publish
   }
   // Publish the I2CResponse
-  publishI2CResponse(&msgi2cResponse);
+  if (!publishI2CResponse(&msgi2cResponse))
+    return false;
   return is_success;
 }
 
@@ -894,12 +861,6 @@ void cbSignalI2CReq(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE [Topic: Signal-I2C]: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Zero-out existing I2C signal msg.
   WS.msgSignalI2C = wippersnapper_signal_v1_I2CRequest_init_zero;
 
@@ -908,10 +869,11 @@ void cbSignalI2CReq(char *data, uint16_t len) {
   WS.msgSignalI2C.cb_payload.funcs.decode = cbDecodeSignalRequestI2C;
 
   // Decode I2C signal request
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_I2CRequest_fields,
                     &WS.msgSignalI2C))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode I2C message");
+  WS._scheduler->wake(WS_TASK_I2C);
 }
 
 /******************************************************************************************/
@@ -984,20 +946,17 @@ bool cbDecodeServoMsg(pb_istream_t *stream, const pb_field_t *field,
            msgServoAttachReq.servo_pin);
 
     // Encode and publish response back to broker
-    memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-    pb_ostream_t ostream = pb_ostream_from_buffer(WS._buffer_outgoing,
-                                                  sizeof(WS._buffer_outgoing));
-    if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_ServoResponse_fields,
-                      &msgServoResp)) {
+    msgSz = ws_pb_encode_to_buffer(
+        WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+        wippersnapper_signal_v1_ServoResponse_fields, &msgServoResp);
+    if (msgSz == 0) {
       WS_DEBUG_PRINTLN("ERROR: Unable to encode servo response message!");
       return false;
     }
-    pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_ServoResponse_fields,
-                        &msgServoResp);
     WS_DEBUG_PRINT("-> Servo Attach Response...");
-    WS._mqtt->publish(WS._topic_signal_servo_device, WS._buffer_outgoing, msgSz,
-                      1);
-    WS_DEBUG_PRINTLN("Published!");
+    WS._publishQueue->enqueue(WS._topic_signal_servo_device,
+                              WS._buffer_outgoing, msgSz, 1);
+    WS_DEBUG_PRINTLN("Queued!");
   } else if (field->tag ==
              wippersnapper_signal_v1_ServoRequest_servo_write_tag) {
     WS_DEBUG_PRINTLN("GOT: Servo Write");
@@ -1077,18 +1036,12 @@ void cbServoMsg(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE [Topic: Servo]: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Set up the payload callback, which will set up the callbacks for
   // each oneof payload field once the field tag is known
   WS.msgServo.cb_payload.funcs.decode = cbDecodeServoMsg;
 
   // Decode servo message from buffer
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_ServoRequest_fields,
                     &WS.msgServo))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode servo message");
@@ -1149,24 +1102,20 @@ bool cbPWMDecodeMsg(pb_istream_t *stream, const pb_field_t *field, void **arg) {
     strcpy(msgPWMResponse.payload.attach_response.pin, msgPWMAttachRequest.pin);
 
     // Encode and publish response back to broker
-    memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-    pb_ostream_t ostream = pb_ostream_from_buffer(WS._buffer_outgoing,
-                                                  sizeof(WS._buffer_outgoing));
-    if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_PWMResponse_fields,
-                      &msgPWMResponse)) {
+    size_t msgSz = ws_pb_encode_to_buffer(
+        WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+        wippersnapper_signal_v1_PWMResponse_fields, &msgPWMResponse);
+    if (msgSz == 0) {
       WS_DEBUG_PRINTLN("ERROR: Unable to encode PWM response message!");
       return false;
     }
-    size_t msgSz; // message's encoded size
-    pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_PWMResponse_fields,
-                        &msgPWMResponse);
-    WS_DEBUG_PRINT("PUBLISHING: PWM Attach Response...");
-    if (!WS._mqtt->publish(WS._topic_signal_pwm_device, WS._buffer_outgoing,
-                           msgSz, 1)) {
-      WS_DEBUG_PRINTLN("ERROR: Failed to publish PWM Attach Response!");
+    WS_DEBUG_PRINT("QUEUEING: PWM Attach Response...");
+    if (!WS._publishQueue->enqueue(WS._topic_signal_pwm_device,
+                                   WS._buffer_outgoing, msgSz, 1)) {
+      WS_DEBUG_PRINTLN("ERROR: Failed to queue PWM Attach Response!");
       return false;
     }
-    WS_DEBUG_PRINTLN("Published!");
+    WS_DEBUG_PRINTLN("Queued!");
 
 #ifdef USE_DISPLAY
     char buffer[100];
@@ -1286,18 +1235,12 @@ void cbPWMMsg(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE [Topic: PWM]: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Set up the payload callback, which will set up the callbacks for
   // each oneof payload field once the field tag is known
   WS.msgPWM.cb_payload.funcs.decode = cbPWMDecodeMsg;
 
   // Decode servo message from buffer
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_PWMRequest_fields,
                     &WS.msgPWM))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode PWM message");
@@ -1373,12 +1316,6 @@ void cbSignalDSReq(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE [Topic: Signal-DS]: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Zero-out existing I2C signal msg.
   // WS.msgSignalDS = wippersnapper_signal_v1_Ds18x20Request_init_zero;
 
@@ -1387,10 +1324,11 @@ void cbSignalDSReq(char *data, uint16_t len) {
   WS.msgSignalDS.cb_payload.funcs.decode = cbDecodeDs18x20Msg;
 
   // Decode DS signal request
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_Ds18x20Request_fields,
                     &WS.msgSignalDS))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode DS message");
+  WS._scheduler->wake(WS_TASK_DS18X20);
 }
 
 /******************************************************************************************/
@@ -1468,6 +1406,25 @@ bool cbDecodePixelsMsg(pb_istream_t *stream, const pb_field_t *field,
 
     // fill strand
     WS._ws_pixelsComponent->fillStrand(&msgPixelsWritereq);
+  } else if (field->tag ==
+             wippersnapper_signal_v1_PixelsRequest_req_pixels_animate_tag) {
+    WS_DEBUG_PRINTLN(
+        "[Message Type]: "
+        "wippersnapper_signal_v1_PixelsRequest_req_pixels_animate_tag");
+
+    // attempt to decode pixel animation message
+    wippersnapper_pixels_v1_PixelsAnimateRequest msgPixelsAnimateReq =
+        wippersnapper_pixels_v1_PixelsAnimateRequest_init_zero;
+    if (!ws_pb_decode(stream,
+                      wippersnapper_pixels_v1_PixelsAnimateRequest_fields,
+                      &msgPixelsAnimateReq)) {
+      WS_DEBUG_PRINTLN("ERROR: Could not decode message of type "
+                       "wippersnapper_pixels_v1_PixelsAnimateRequest!");
+      return false;
+    }
+
+    // start animation, frames are rendered by WS_TASK_PIXELS
+    WS._ws_pixelsComponent->animateStrand(&msgPixelsAnimateReq);
   } else {
     WS_DEBUG_PRINTLN("ERROR: Pixels message type not found!");
     return false;
@@ -1489,21 +1446,16 @@ void cbPixelsMsg(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE [Topic: Pixels]: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Set up the payload callback, which will set up the callbacks for
   // each oneof payload field once the field tag is known
   WS.msgPixels.cb_payload.funcs.decode = cbDecodePixelsMsg;
 
   // Decode pixel message from buffer
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_PixelsRequest_fields,
                     &WS.msgPixels))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode pixel topic message");
+  WS._scheduler->wake(WS_TASK_PIXELS);
 }
 
 /******************************************************************************************/
@@ -1544,11 +1496,8 @@ bool cbDecodeUARTMessage(pb_istream_t *stream, const pb_field_t *field,
       return false;
     }
 
-    // Have we previously initialized the UART bus?
-    if (!WS._uartComponent->isUARTBusInitialized())
-      WS._uartComponent->initUARTBus(&msgUARTInitReq); // Init. UART bus
-
-    // Attach UART device to the bus specified in the message
+    // Attach UART device to the bus specified in the message, initializing
+    // the bus if no other device uses its pins
     bool did_begin = WS._uartComponent->initUARTDevice(&msgUARTInitReq);
 
     // Create a UARTResponse message
@@ -1559,24 +1508,20 @@ bool cbDecodeUARTMessage(pb_istream_t *stream, const pb_field_t *field,
     msgUARTResponse.payload.resp_uart_device_attach.is_success = did_begin;
     strcpy(msgUARTResponse.payload.resp_uart_device_attach.device_id,
            msgUARTInitReq.device_id);
-    memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-    pb_ostream_t ostream = pb_ostream_from_buffer(WS._buffer_outgoing,
-                                                  sizeof(WS._buffer_outgoing));
-    if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_UARTResponse_fields,
-                      &msgUARTResponse)) {
+    size_t msgSz = ws_pb_encode_to_buffer(
+        WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+        wippersnapper_signal_v1_UARTResponse_fields, &msgUARTResponse);
+    if (msgSz == 0) {
       WS_DEBUG_PRINTLN("ERROR: Unable to encode UART response message!");
       return false;
     }
-    size_t msgSz; // message's encoded size
-    pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_UARTResponse_fields,
-                        &msgUARTResponse);
-    WS_DEBUG_PRINT("PUBLISHING: UART Attach Response...");
-    if (!WS._mqtt->publish(WS._topic_signal_uart_device, WS._buffer_outgoing,
-                           msgSz, 1)) {
-      WS_DEBUG_PRINTLN("ERROR: Failed to publish UART Attach Response!");
+    WS_DEBUG_PRINT("QUEUEING: UART Attach Response...");
+    if (!WS._publishQueue->enqueue(WS._topic_signal_uart_device,
+                                   WS._buffer_outgoing, msgSz, 1)) {
+      WS_DEBUG_PRINTLN("ERROR: Failed to queue UART Attach Response!");
       return false;
     }
-    WS_DEBUG_PRINTLN("Published!");
+    WS_DEBUG_PRINTLN("Queued!");
 
   } else if (field->tag ==
              wippersnapper_signal_v1_UARTRequest_req_uart_device_detach_tag) {
@@ -1614,55 +1559,78 @@ void cbSignalUARTReq(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("* NEW MESSAGE on Signal of type UART: ");
   WS_DEBUG_PRINT(len);
   WS_DEBUG_PRINTLN(" bytes.");
-  // zero-out current buffer
-  memset(WS._buffer, 0, sizeof(WS._buffer));
-  // copy mqtt data into buffer
-  memcpy(WS._buffer, data, len);
-  WS.bufSize = len;
-
   // Set up the payload callback, which will set up the callbacks for
   // each oneof payload field once the field tag is known
   WS.msgSignalUART.cb_payload.funcs.decode = cbDecodeUARTMessage;
 
   // Decode DS signal request
-  pb_istream_t istream = pb_istream_from_buffer(WS._buffer, WS.bufSize);
+  pb_istream_t istream = pb_istream_from_buffer((pb_byte_t *)data, len);
   if (!ws_pb_decode(&istream, wippersnapper_signal_v1_UARTRequest_fields,
                     &WS.msgSignalUART))
     WS_DEBUG_PRINTLN("ERROR: Unable to decode UART Signal message");
+  WS._scheduler->wake(WS_TASK_UART);
 }
 
 /****************************************************************************/
 /*!
-    @brief    Handles MQTT messages on signal topic until timeout.
+    @brief    Fills a signal message with a digital pin event, numeric if
+              the broker supports it.
     @param    outgoingSignalMsg
                 Empty signal message struct.
     @param    pinName
                 Name of pin.
     @param    pinVal
                 Value of pin.
-    @returns  True if pinEvent message encoded successfully, false otherwise.
 */
 /****************************************************************************/
-bool Wippersnapper::encodePinEvent(
+void Wippersnapper::fillPinEvent(
     wippersnapper_signal_v1_CreateSignalRequest *outgoingSignalMsg,
     uint8_t pinName, int pinVal) {
-  bool is_success = true;
-  outgoingSignalMsg->which_payload =
-      wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag;
-  // fill the pin_event message
-  sprintf(outgoingSignalMsg->payload.pin_event.pin_name, "D%d", pinName);
-  sprintf(outgoingSignalMsg->payload.pin_event.pin_value, "%d", pinVal);
+  if (_numericPinEvents) {
+    // fill the pin_event_value message, no string formatting needed
+    outgoingSignalMsg->which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_event_value_tag;
+    outgoingSignalMsg->payload.pin_event_value.pin = pinName;
+    outgoingSignalMsg->payload.pin_event_value.mode =
+        wippersnapper_pin_v1_Mode_MODE_DIGITAL;
+    outgoingSignalMsg->payload.pin_event_value.which_value =
+        wippersnapper_pin_v1_PinEventValue_int_value_tag;
+    outgoingSignalMsg->payload.pin_event_value.value.int_value = pinVal;
+  } else {
+    outgoingSignalMsg->which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag;
+    // fill the pin_event message
+    sprintf(outgoingSignalMsg->payload.pin_event.pin_name, "D%d", pinName);
+    sprintf(outgoingSignalMsg->payload.pin_event.pin_value, "%d", pinVal);
+  }
+}
+
+/****************************************************************************/
+/*!
+    @brief    Encodes a digital pin event into _buffer_outgoing.
+    @param    outgoingSignalMsg
+                Empty signal message struct.
+    @param    pinName
+                Name of pin.
+    @param    pinVal
+                Value of pin.
+    @returns  Length of the pinEvent message encoded into _buffer_outgoing,
+              0 if it could not be encoded.
+*/
+/****************************************************************************/
+size_t Wippersnapper::encodePinEvent(
+    wippersnapper_signal_v1_CreateSignalRequest *outgoingSignalMsg,
+    uint8_t pinName, int pinVal) {
+  fillPinEvent(outgoingSignalMsg, pinName, pinVal);
 
   // Encode signal message
-  pb_ostream_t stream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&stream, wippersnapper_signal_v1_CreateSignalRequest_fields,
-                    outgoingSignalMsg)) {
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_CreateSignalRequest_fields, outgoingSignalMsg);
+  if (msgSz == 0)
     WS_DEBUG_PRINTLN("ERROR: Unable to encode signal message");
-    is_success = false;
-  }
 
-  return is_success;
+  return msgSz;
 }
 
 /**************************************************************************/
@@ -2369,6 +2337,8 @@ void Wippersnapper::runNetFSM() {
         fsmNetwork = FSM_NET_CONNECTED;
         return;
       }
+      // Keep queued readings while reconnecting, they are replayed after
+      WS._publishQueue->spool();
       fsmNetwork = FSM_NET_CHECK_NETWORK;
       break;
     case FSM_NET_CHECK_NETWORK:
@@ -2489,6 +2459,68 @@ void Wippersnapper::runNetFSM() {
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief    Checks network and MQTT connectivity without holding up the
+              application loop. While disconnected, makes one network or
+              MQTT connection attempt every WS_NET_RETRY_MS, so components
+              keep sampling into the publish queue, and the offline log,
+              between attempts. Resets the board if the connection is not
+              restored within WS_NET_OFFLINE_TIMEOUT_MS.
+    @returns  True if connected to the broker, False otherwise.
+*/
+/**************************************************************************/
+bool Wippersnapper::pollNetFSM() {
+  if (WS._mqtt->connected()) {
+    _netOffline = false;
+    return true;
+  }
+
+  unsigned long curTime = millis();
+  if (!_netOffline) {
+    WS_DEBUG_PRINTLN("Lost connection to Adafruit IO, reconnecting...");
+    // Keep queued readings while reconnecting, they are replayed after
+    WS._publishQueue->spool();
+    _netOffline = true;
+    _netLostTime = curTime;
+    _netRetryTime = curTime;
+  }
+  if ((long)(curTime - _netRetryTime) < 0)
+    return false;
+  if (curTime - _netLostTime > WS_NET_OFFLINE_TIMEOUT_MS) {
+    WS._publishQueue->spool();
+    haltError("ERROR: Unable to reconnect to Adafruit IO, rebooting soon...",
+              WS_LED_STATUS_MQTT_CONNECTING);
+  }
+  _netRetryTime = curTime + WS_NET_RETRY_MS;
+
+  if (networkStatus() != WS_NET_CONNECTED) {
+    WS_DEBUG_PRINTLN("Reconnecting to WiFi...");
+    statusLEDBlink(WS_LED_STATUS_WIFI_CONNECTING);
+    feedWDT();
+    _connect();
+    feedWDT();
+    if (networkStatus() != WS_NET_CONNECTED)
+      return false;
+    WS_DEBUG_PRINTLN("Connected to WiFi!");
+  }
+
+  WS_DEBUG_PRINTLN("Reconnecting to AIO MQTT...");
+  statusLEDBlink(WS_LED_STATUS_MQTT_CONNECTING);
+  feedWDT();
+  int8_t mqttRC = WS._mqtt->connect();
+  feedWDT();
+  if (mqttRC != WS_MQTT_CONNECTED) {
+    WS_DEBUG_PRINT("MQTT Connection Error: ");
+    WS_DEBUG_PRINTLN(mqttRC);
+    WS_DEBUG_PRINTLN(WS._mqtt->connectErrorString(mqttRC));
+    return false;
+  }
+  WS_DEBUG_PRINTLN("Reconnected to Adafruit IO!");
+  _netOffline = false;
+  return true;
+}
+
 /**************************************************************************/
 /*!
     @brief    Prints an error to the serial and halts the hardware until
@@ -2551,20 +2583,21 @@ ws_board_status_t Wippersnapper::getBoardStatus() { return WS._boardStatus; }
 /*!
     @brief  Pings the MQTT broker within the keepalive interval
             to keep the connection alive. Blinks the keepalive LED
-            every STATUS_LED_KAT_BLINK_TIME milliseconds.
+            every STATUS_LED_KAT_BLINK_TIME milliseconds. A failed
+            ping drops the connection, run() then reconnects.
 */
 /**************************************************************************/
 void Wippersnapper::pingBroker() {
   // ping within keepalive-10% to keep connection open
-  if (millis() > (_prv_ping + (WS_KEEPALIVE_INTERVAL_MS -
+  if (WS._mqtt->connected() &&
+      millis() > (_prv_ping + (WS_KEEPALIVE_INTERVAL_MS -
                                (WS_KEEPALIVE_INTERVAL_MS * 0.10)))) {
     WS_DEBUG_PRINT("Sending MQTT PING: ");
     if (WS._mqtt->ping()) {
       WS_DEBUG_PRINTLN("SUCCESS!");
     } else {
-      WS_DEBUG_PRINTLN("FAILURE! Running network FSM...");
+      WS_DEBUG_PRINTLN("FAILURE! Reconnecting...");
       WS._mqtt->disconnect();
-      runNetFSM();
     }
     _prv_ping = millis();
     WS_DEBUG_PRINT("WiFi RSSI: ");
@@ -2847,42 +2880,105 @@ void Wippersnapper::publishPinConfigComplete() {
              _message_len, 1);
 }
 
+/**************************************************************************/
+/*!
+    @brief    Runs a task from the scheduler and reschedules it.
+    @param    task
+              Task whose deadline has passed.
+    @param    curTime
+              Time the scheduler pass started, from millis().
+*/
+/**************************************************************************/
+void Wippersnapper::runTask(ws_task_t task, unsigned long curTime) {
+  unsigned long nextTime = millis() + WS_SCHEDULER_IDLE_MS;
+  switch (task) {
+  case WS_TASK_KEEPALIVE:
+    pingBroker();
+    nextTime = _prvKATBlink + STATUS_LED_KAT_BLINK_TIME + 1;
+    // there is nothing to ping while run() is reconnecting
+    if (WS._mqtt->connected())
+      nextTime = ws_scheduler::earliest(
+          nextTime,
+          _prv_ping + (unsigned long)(WS_KEEPALIVE_INTERVAL_MS -
+                                      (WS_KEEPALIVE_INTERVAL_MS * 0.10)) + 1);
+    break;
+  case WS_TASK_DIGITAL_IN:
+    WS._digitalGPIO->processDigitalInputs();
+    nextTime = WS._digitalGPIO->getNextUpdateTime(millis());
+    break;
+  case WS_TASK_ANALOG_IN:
+    WS._analogIO->update();
+    nextTime = WS._analogIO->getNextUpdateTime(millis());
+    break;
+  case WS_TASK_I2C:
+    if (WS._isI2CPort0Init) {
+      WS._i2cPort0->update();
+      nextTime = WS._i2cPort0->getNextUpdateTime();
+    }
+    break;
+  case WS_TASK_DS18X20:
+    WS._ds18x20Component->update();
+    nextTime = WS._ds18x20Component->getNextUpdateTime(millis());
+    break;
+  case WS_TASK_UART:
+    WS._uartComponent->update();
+    nextTime = WS._uartComponent->getNextUpdateTime(millis());
+    break;
+  case WS_TASK_PIXELS:
+    WS._ws_pixelsComponent->update();
+    nextTime = WS._ws_pixelsComponent->getNextUpdateTime(millis());
+    break;
+  default:
+    break;
+  }
+  // A task runs at most once per pass, one which is still due is picked up
+  // on the next pass rather than spinning this one
+  if ((long)(nextTime - curTime) <= 0)
+    nextTime = curTime + 1;
+  WS._scheduler->schedule(task, nextTime);
+}
+
 /**************************************************************************/
 /*!
     @brief    Processes incoming commands and handles network connection.
+              Components keep running while the connection is restored.
     @returns  Network status, as ws_status_t.
 */
 /**************************************************************************/
 ws_status_t Wippersnapper::run() {
-  // Check networking
-  runNetFSM();
-  WS.feedWDT();
-  pingBroker();
-
-  // Process all incoming packets from Wippersnapper MQTT Broker
-  WS._mqtt->processPackets(10);
-  WS.feedWDT();
-
-  // Process digital inputs, digitalGPIO module
-  WS._digitalGPIO->processDigitalInputs();
+  // Check networking, reconnecting a step at a time
+  bool online = pollNetFSM();
   WS.feedWDT();
 
-  // Process analog inputs
-  WS._analogIO->update();
-  WS.feedWDT();
-
-  // Process I2C sensor events
-  if (WS._isI2CPort0Init)
-    WS._i2cPort0->update();
-  WS.feedWDT();
+  // Edges captured by interrupt are published on this pass
+  if (WS._digitalGPIO != nullptr && WS._digitalGPIO->hasPendingEdges())
+    WS._scheduler->wake(WS_TASK_DIGITAL_IN);
 
-  // Process DS18x20 sensor events
-  WS._ds18x20Component->update();
-  WS.feedWDT();
+  // Service only the tasks whose deadline has passed
+  ws_task_t task;
+  unsigned long curTime = millis();
+  while (WS._scheduler->popDue(curTime, task)) {
+    runTask(task, curTime);
+    WS.feedWDT();
+  }
 
-  // Process UART sensor events
-  WS._uartComponent->update();
+  // Publish what the tasks queued, a budget of messages per pass, or spool
+  // it to the offline log while reconnecting
+  WS._publishQueue->drain(WS._mqtt);
+
+  // Process incoming packets from Wippersnapper MQTT Broker, waiting in the
+  // MQTT client until the earliest deadline
+  unsigned long waitMs = WS._scheduler->msUntilNext(millis());
+  if (waitMs < WS_RUN_MIN_WAIT_MS || !WS._publishQueue->isEmpty())
+    waitMs = WS_RUN_MIN_WAIT_MS;
+  if (waitMs > WS_RUN_MAX_WAIT_MS)
+    waitMs = WS_RUN_MAX_WAIT_MS;
+  if (online)
+    WS._mqtt->processPackets((int16_t)waitMs);
+  else
+    delay(waitMs); // a disconnected client returns at once
   WS.feedWDT();
 
-  return WS_NET_CONNECTED; // TODO: Make this funcn void!
+  // TODO: Make this funcn void!
+  return online ? WS_NET_CONNECTED : WS_NET_DISCONNECTED;
 }
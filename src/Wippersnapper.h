@@ -114,6 +114,9 @@
 #include "components/analogIO/Wippersnapper_AnalogIO.h"
 #include "components/digitalIO/Wippersnapper_DigitalGPIO.h"
 #include "components/i2c/WipperSnapper_I2C.h"
+#include "components/publish/ws_pin_event_batch.h"
+#include "components/publish/ws_publish_queue.h"
+#include "components/scheduler/ws_scheduler.h"
 
 // Includes for ESP32-only
 #ifdef ARDUINO_ARCH_ESP32
@@ -223,6 +226,17 @@ typedef enum {
 #define WS_MQTT_MAX_PAYLOAD_SIZE                                               \
   512 ///< MAXIMUM expected payload size, in bytes
 
+#define WS_RUN_MIN_WAIT_MS                                                     \
+  10 ///< Shortest time run() waits for MQTT packets, in milliseconds
+#define WS_RUN_MAX_WAIT_MS                                                     \
+  250 ///< Longest time run() waits for MQTT packets, in milliseconds
+#define WS_NET_RETRY_MS                                                        \
+  3000 ///< Time between the reconnection attempts run() makes, in milliseconds
+#ifndef WS_NET_OFFLINE_TIMEOUT_MS
+#define WS_NET_OFFLINE_TIMEOUT_MS                                              \
+  900000UL ///< Offline time before run() resets the board, in milliseconds
+#endif
+
 class Wippersnapper_DigitalGPIO;
 class Wippersnapper_AnalogIO;
 class Wippersnapper_FS;
@@ -292,6 +306,7 @@ public:
 
   // run() loop
   ws_status_t run();
+  void runTask(ws_task_t task, unsigned long curTime);
   void processPackets();
   void publish(const char *topic, uint8_t *payload, uint16_t bLen,
                uint8_t qos = 0);
@@ -299,6 +314,7 @@ public:
   // Networking helpers
   void pingBroker();
   void runNetFSM();
+  bool pollNetFSM();
 
   // WDT helpers
   void enableWDT(int timeoutMS = 0);
@@ -312,10 +328,14 @@ public:
   // MQTT topic callbacks //
   // Decodes a signal message
   bool decodeSignalMsg(
-      wippersnapper_signal_v1_CreateSignalRequest *encodedSignalMsg);
+      wippersnapper_signal_v1_CreateSignalRequest *encodedSignalMsg,
+      const pb_byte_t *buffer, size_t len);
 
   // Encodes a pin event message
-  bool
+  void
+  fillPinEvent(wippersnapper_signal_v1_CreateSignalRequest *outgoingSignalMsg,
+               uint8_t pinName, int pinVal);
+  size_t
   encodePinEvent(wippersnapper_signal_v1_CreateSignalRequest *outgoingSignalMsg,
                  uint8_t pinName, int pinVal);
 
@@ -335,15 +355,18 @@ public:
   bool _isI2CPort1Init =
       false; ///< True if I2C port 1 has been initialized, False otherwise.
 
-  uint8_t _buffer[WS_MQTT_MAX_PAYLOAD_SIZE]; /*!< Shared buffer to save callback
-                                                payload */
   uint8_t
       _buffer_outgoing[WS_MQTT_MAX_PAYLOAD_SIZE]; /*!< buffer which contains
                                                      outgoing payload data */
-  uint16_t bufSize; /*!< Length of data inside buffer */
 
   ws_board_status_t _boardStatus =
       WS_BOARD_DEF_IDLE; ///< Hardware's registration status
+  bool _numericPinEvents =
+      false; ///< True if the broker accepts numeric PinEventValue messages
+  bool _pinEventBatches =
+      false; ///< True if the broker accepts batched PinEvents messages
+  bool _ds18x20SensorAddresses =
+      false; ///< True if the broker tells DS18x20 sensors apart by address
 
   // TODO: We really should look at making these static definitions, not dynamic
   // to free up space on the heap
@@ -357,11 +380,15 @@ public:
   ws_display_ui_helper *_ui_helper =
       nullptr; ///< Instance of display UI helper class
 #endif
-  ws_pixels *_ws_pixelsComponent; ///< ptr to instance of ws_pixels class
-  ws_pwm *_pwmComponent;          ///< Instance of pwm class
-  ws_servo *_servoComponent;      ///< Instance of servo class
-  ws_ds18x20 *_ds18x20Component;  ///< Instance of DS18x20 class
-  ws_uart *_uartComponent;        ///< Instance of UART class
+  ws_pixels *_ws_pixelsComponent;  ///< ptr to instance of ws_pixels class
+  ws_pwm *_pwmComponent;           ///< Instance of pwm class
+  ws_servo *_servoComponent;       ///< Instance of servo class
+  ws_ds18x20 *_ds18x20Component;   ///< Instance of DS18x20 class
+  ws_uart *_uartComponent;         ///< Instance of UART class
+  ws_scheduler *_scheduler;        ///< Schedules the tasks run() services
+  ws_publish_queue *_publishQueue; ///< Outbound messages, drained by run()
+  ws_offline_log *_offlineLog =
+      nullptr; ///< Spools outbound messages while offline, if supported
 
   // TODO: does this really need to be global?
   uint8_t _macAddr[6];  /*!< Unique network iface identifier */
@@ -447,6 +474,11 @@ protected:
   uint32_t _prvKATBlink = 0; /*!< Previous time when client pinged Adafruit IO's
                              MQTT broker, in milliseconds. */
 
+  // Reconnection state of run()
+  bool _netOffline = false;        /*!< True while run() is reconnecting */
+  unsigned long _netLostTime = 0;  /*!< When the connection was lost */
+  unsigned long _netRetryTime = 0; /*!< When run() next tries to reconnect */
+
   // Device information
   const char *_deviceId; /*!< Adafruit IO+ device identifier string */
   char *_device_uid;     /*!< Unique device identifier  */
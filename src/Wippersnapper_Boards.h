@@ -190,6 +190,10 @@
 #define USE_TINYUSB
 #define USE_STATUS_LED
 #define STATUS_LED_PIN 32
+#elif defined(WS_NATIVE)
+#define BOARD_ID "native"
+#define USE_STATUS_LED
+#define STATUS_LED_PIN 13
 #else
 #warning "Board type not identified within Wippersnapper_Boards.h!"
 #endif
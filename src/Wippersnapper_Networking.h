@@ -16,7 +16,11 @@
 #ifndef WIPPERSNAPPER_NETWORKING_H
 #define WIPPERSNAPPER_NETWORKING_H
 
-#if defined(ADAFRUIT_METRO_M4_EXPRESS) ||                                      \
+#if defined(WS_NATIVE)
+#include "network_interfaces/ws_networking_native.h"
+/** Simulated host networking class */
+typedef ws_networking_native Wippersnapper_WiFi;
+#elif defined(ADAFRUIT_METRO_M4_EXPRESS) ||                                    \
     defined(ADAFRUIT_METRO_M4_AIRLIFT_LITE) || defined(ADAFRUIT_PYPORTAL) ||   \
     defined(ADAFRUIT_PYPORTAL_M4_TITANO) || defined(USE_AIRLIFT)
 #include "network_interfaces/Wippersnapper_AIRLIFT.h"
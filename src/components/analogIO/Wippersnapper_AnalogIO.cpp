@@ -42,6 +42,7 @@ Wippersnapper_AnalogIO::Wippersnapper_AnalogIO(int32_t totalAnalogInputPins,
   for (int pin = 0; pin < _totalAnalogInputPins; pin++) {
     // turn sampling off
     _analog_input_pins[pin].enabled = false;
+    _analog_input_pins[pin].capture = nullptr;
   }
 }
 
@@ -52,6 +53,8 @@ Wippersnapper_AnalogIO::Wippersnapper_AnalogIO(int32_t totalAnalogInputPins,
 /***********************************************************************************/
 Wippersnapper_AnalogIO::~Wippersnapper_AnalogIO() {
   _aRef = 0.0;
+  for (int i = 0; i < _totalAnalogInputPins; i++)
+    stopCapture(_analog_input_pins[i]);
   _totalAnalogInputPins = 0;
   delete _analog_input_pins;
 }
@@ -157,7 +160,13 @@ void Wippersnapper_AnalogIO::initAnalogInputPin(
       _analog_input_pins[i].period = periodMs;
       _analog_input_pins[i].prvPeriod = 0L;
       _analog_input_pins[i].readMode = analogReadMode;
+      _analog_input_pins[i].filter = WS_ANALOG_FILTER;
+      _analog_input_pins[i].oversample = WS_ANALOG_OVERSAMPLE;
+      _analog_input_pins[i].median3 = WS_ANALOG_MEDIAN3;
+      _analog_input_pins[i].emaPrimed = 0;
       _analog_input_pins[i].enabled = true;
+      if (periodMs != 0L && isCapturePin(pin))
+        startCapture(_analog_input_pins[i]);
       break;
     }
   }
@@ -176,6 +185,7 @@ void Wippersnapper_AnalogIO::disableAnalogInPin(int pin) {
   for (int i = 0; i < _totalAnalogInputPins; i++) {
     if (_analog_input_pins[i].pinName == pin) {
       _analog_input_pins[i].enabled = false;
+      stopCapture(_analog_input_pins[i]);
       break;
     }
   }
@@ -244,6 +254,248 @@ float Wippersnapper_AnalogIO::getPinValueVolts(int pin) {
 #endif
 }
 
+/***********************************************************************************/
+/*!
+    @brief  Sets the filter applied to an analog input pin's samples.
+    @param  pin
+            The analog input pin.
+    @param  filter
+            Filter to apply.
+    @param  oversample
+            ADC samples averaged per reading, unused by
+            WS_ANALOG_FILTER_NONE.
+    @param  median3
+            True to take each sample as the median of three reads,
+            rejecting single-read spikes.
+*/
+/***********************************************************************************/
+void Wippersnapper_AnalogIO::setInputFilter(int pin, ws_analog_filter_t filter,
+                                            uint8_t oversample, bool median3) {
+  for (int i = 0; i < _totalAnalogInputPins; i++) {
+    if (_analog_input_pins[i].enabled &&
+        _analog_input_pins[i].pinName == pin) {
+      _analog_input_pins[i].filter = filter;
+      _analog_input_pins[i].oversample = oversample > 0 ? oversample : 1;
+      _analog_input_pins[i].median3 = median3;
+      _analog_input_pins[i].emaPrimed = 0;
+      break;
+    }
+  }
+}
+
+/**********************************************************/
+/*!
+    @brief    Reads one ADC sample from an analog pin.
+    @param    pin
+              The pin to be read.
+    @param    millivolts
+              True for the core's calibrated reading in
+              millivolts, where it has one, False for the
+              16-bit ADC value.
+    @returns  The sample.
+*/
+/**********************************************************/
+uint16_t Wippersnapper_AnalogIO::readSample(int pin, bool millivolts) {
+#ifdef ARDUINO_ARCH_ESP32
+  if (millivolts)
+    return analogReadMilliVolts(pin);
+#endif
+  (void)millivolts;
+  return getPinValue(pin);
+}
+
+/**********************************************************/
+/*!
+    @brief    Returns the middle of three values.
+    @param    a
+              First value.
+    @param    b
+              Second value.
+    @param    c
+              Third value.
+    @returns  The median.
+*/
+/**********************************************************/
+static uint16_t medianOf3(uint16_t a, uint16_t b, uint16_t c) {
+  if (a > b) {
+    uint16_t t = a;
+    a = b;
+    b = t;
+  }
+  // a <= b, so the median is b clamped to [a, c]
+  return c < a ? a : (c < b ? c : b);
+}
+
+/**********************************************************/
+/*!
+    @brief    Reads an analog pin through its filter:
+              oversamples, optionally median-of-3 per
+              sample, averages and, for WS_ANALOG_FILTER_EMA,
+              smooths across successive readings.
+    @param    pin
+              The analog input pin.
+    @param    millivolts
+              True for a calibrated reading in millivolts,
+              see readSample().
+    @returns  The filtered reading.
+*/
+/**********************************************************/
+uint16_t Wippersnapper_AnalogIO::readFiltered(analogInputPin &pin,
+                                              bool millivolts) {
+  uint8_t samples =
+      pin.filter == WS_ANALOG_FILTER_NONE || pin.oversample == 0
+          ? 1
+          : pin.oversample;
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < samples; i++) {
+    uint16_t sample = readSample(pin.pinName, millivolts);
+    if (pin.median3) {
+      uint16_t b = readSample(pin.pinName, millivolts);
+      sample = medianOf3(sample, b, readSample(pin.pinName, millivolts));
+    }
+    sum += sample;
+  }
+  uint16_t value = (uint16_t)((sum + samples / 2) / samples);
+  if (pin.filter != WS_ANALOG_FILTER_EMA)
+    return value;
+
+  // Exponential moving average in Q24.8 fixed point
+  int32_t &ema = pin.ema[millivolts];
+  uint8_t primed = millivolts ? 0x02 : 0x01;
+  if (!(pin.emaPrimed & primed)) {
+    ema = (int32_t)value << 8;
+    pin.emaPrimed |= primed;
+  } else {
+    ema += (((int32_t)value << 8) - ema) / (1 << WS_ANALOG_EMA_SHIFT);
+  }
+  return (uint16_t)((ema + 128) >> 8);
+}
+
+/**********************************************************/
+/*!
+    @brief    Reads an analog pin's filtered voltage.
+    @param    pin
+              The analog input pin.
+    @param    filteredRaw
+              The pin's filtered 16-bit value if it was
+              already read this pass, -1 otherwise.
+    @returns  The pin's voltage.
+*/
+/**********************************************************/
+float Wippersnapper_AnalogIO::readFilteredVolts(analogInputPin &pin,
+                                                int32_t filteredRaw) {
+#ifdef ARDUINO_ARCH_ESP32
+  // use the core's calibrated conversion
+  (void)filteredRaw;
+  return readFiltered(pin, true) / 1000.0;
+#else
+  if (filteredRaw < 0)
+    filteredRaw = readFiltered(pin, false);
+  return filteredRaw * getAref() / 65536;
+#endif
+}
+
+/**********************************************************/
+/*!
+    @brief    Checks if a pin is listed in WS_ANALOG_CAPTURE_PINS.
+    @param    pin
+              The analog pin.
+    @returns  True if the pin is captured continuously.
+*/
+/**********************************************************/
+bool Wippersnapper_AnalogIO::isCapturePin(int pin) {
+#ifdef WS_ANALOG_CAPTURE_PINS
+  static const uint8_t capturePins[] = {WS_ANALOG_CAPTURE_PINS};
+  for (size_t i = 0; i < sizeof(capturePins); i++) {
+    if (capturePins[i] == pin)
+      return true;
+  }
+#endif
+  (void)pin;
+  return false;
+}
+
+/**********************************************************/
+/*!
+    @brief    Starts continuously capturing an analog input
+              pin, leaving it polled if that fails.
+    @param    pin
+              The analog input pin.
+*/
+/**********************************************************/
+void Wippersnapper_AnalogIO::startCapture(analogInputPin &pin) {
+  stopCapture(pin);
+  int readBits = scaleAnalogRead ? getNativeResolution() : getADCresolution();
+  pin.capture = new ws_adc_capture(ws_adc_source::create((uint8_t)readBits));
+  if (!pin.capture->begin((uint8_t)pin.pinName)) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to capture analog pin, polling it");
+    stopCapture(pin);
+    return;
+  }
+  WS_DEBUG_PRINT("Capturing analog pin at (Hz): ");
+  WS_DEBUG_PRINTLN(WS_ADC_CAPTURE_RATE_HZ);
+}
+
+/**********************************************************/
+/*!
+    @brief    Stops continuously capturing an analog input
+              pin.
+    @param    pin
+              The analog input pin.
+*/
+/**********************************************************/
+void Wippersnapper_AnalogIO::stopCapture(analogInputPin &pin) {
+  delete pin.capture;
+  pin.capture = nullptr;
+}
+
+/**********************************************************/
+/*!
+    @brief    Reduces the samples a pin captured over its
+              period to WS_ANALOG_CAPTURE_STAT.
+    @param    pin
+              The analog input pin, which must be capturing.
+    @param    pinValRaw
+              The statistic, in 16-bit ADC counts.
+    @param    pinValVolts
+              The statistic, in volts.
+    @returns  True if any samples were captured.
+*/
+/**********************************************************/
+bool Wippersnapper_AnalogIO::readCapture(analogInputPin &pin,
+                                         uint16_t &pinValRaw,
+                                         float &pinValVolts) {
+  ws_adc_stats_t stats;
+  if (!pin.capture->takeStats(stats))
+    return false;
+  if (stats.lost > 0) {
+    WS_DEBUG_PRINT("WARNING: Analog capture lost samples: ");
+    WS_DEBUG_PRINTLN(stats.lost);
+  }
+
+  float val;
+  switch (WS_ANALOG_CAPTURE_STAT) {
+  case WS_ADC_STAT_MEAN:
+    val = stats.mean;
+    break;
+  case WS_ADC_STAT_MIN:
+    val = stats.min;
+    break;
+  case WS_ADC_STAT_MAX:
+    val = stats.max;
+    break;
+  case WS_ADC_STAT_P2P:
+    val = stats.p2p;
+    break;
+  default:
+    val = stats.rms;
+    break;
+  }
+  pinValRaw = (uint16_t)(val + 0.5f);
+  pinValVolts = val * getAref() / 65536;
+  return true;
+}
+
 /******************************************************************/
 /*!
     @brief    Encodes an analog input pin event into a
@@ -269,92 +521,105 @@ bool Wippersnapper_AnalogIO::encodePinEvent(
   wippersnapper_signal_v1_CreateSignalRequest outgoingSignalMsg =
       wippersnapper_signal_v1_CreateSignalRequest_init_zero;
 
-  // Fill payload
-  outgoingSignalMsg.which_payload =
-      wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag;
-  sprintf(outgoingSignalMsg.payload.pin_event.pin_name, "A%d", pinName);
+  bool readRaw =
+      readMode ==
+      wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VALUE;
 
-  // Fill pinValue based on the analog read mode
-  char buffer[100];
-  if (readMode ==
-      wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VALUE) {
-    sprintf(outgoingSignalMsg.payload.pin_event.pin_value, "%u", pinValRaw);
-    snprintf(buffer, 100, "[Pin] A%d read: %u\n", pinName, pinValRaw);
+  // Fill payload
+  if (WS._numericPinEvents) {
+    // Send the value itself, skipping printf formatting
+    outgoingSignalMsg.which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_event_value_tag;
+    wippersnapper_pin_v1_PinEventValue &event =
+        outgoingSignalMsg.payload.pin_event_value;
+    event.pin = pinName;
+    event.mode = wippersnapper_pin_v1_Mode_MODE_ANALOG;
+    if (readRaw) {
+      event.which_value = wippersnapper_pin_v1_PinEventValue_int_value_tag;
+      event.value.int_value = pinValRaw;
+    } else {
+      event.which_value = wippersnapper_pin_v1_PinEventValue_float_value_tag;
+      event.value.float_value = pinValVolts;
+    }
   } else {
-    sprintf(outgoingSignalMsg.payload.pin_event.pin_value, "%0.3f",
-            pinValVolts);
-    snprintf(buffer, 100, "[Pin] A%d read: %0.2f\n", pinName, pinValVolts);
+    outgoingSignalMsg.which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag;
+    sprintf(outgoingSignalMsg.payload.pin_event.pin_name, "A%d", pinName);
+    // Fill pinValue based on the analog read mode
+    if (readRaw)
+      sprintf(outgoingSignalMsg.payload.pin_event.pin_value, "%u", pinValRaw);
+    else
+      sprintf(outgoingSignalMsg.payload.pin_event.pin_value, "%0.3f",
+              pinValVolts);
   }
 // display analog pin read on terminal
 #ifdef USE_DISPLAY
+  char buffer[100];
+  if (readRaw)
+    snprintf(buffer, 100, "[Pin] A%d read: %u\n", pinName, pinValRaw);
+  else
+    snprintf(buffer, 100, "[Pin] A%d read: %0.2f\n", pinName, pinValVolts);
   WS._ui_helper->add_text_to_terminal(buffer);
 #endif
 
+  // Within update() events are published together
+  if (_pinEvents.isOpen())
+    return _pinEvents.add(outgoingSignalMsg, (uint32_t)pinName + 1);
+
   // Encode signal message
-  pb_ostream_t stream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&stream, wippersnapper_signal_v1_CreateSignalRequest_fields,
-                    &outgoingSignalMsg)) {
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_CreateSignalRequest_fields, &outgoingSignalMsg);
+  if (msgSz == 0) {
     WS_DEBUG_PRINTLN("ERROR: Unable to encode signal message");
     return false;
   }
 
-  // Publish out to IO
-  size_t msgSz;
-  pb_get_encoded_size(&msgSz,
-                      wippersnapper_signal_v1_CreateSignalRequest_fields,
-                      &outgoingSignalMsg);
-  WS_DEBUG_PRINT("Publishing pinEvent...");
-  WS.publish(WS._topic_signal_device, WS._buffer_outgoing, msgSz, 1);
-  WS_DEBUG_PRINTLN("Published!");
+  // Queue for publishing, replacing any unsent reading from this pin
+  WS_DEBUG_PRINT("Queueing pinEvent...");
+  WS._publishQueue->enqueue(WS._topic_signal_device, WS._buffer_outgoing,
+                            msgSz, 1, (uint32_t)pinName + 1);
+  WS_DEBUG_PRINTLN("Queued!");
 
   return true;
 }
 
 /**********************************************************/
 /*!
-    @brief    Calculates the hysteresis for the pin value.
+    @brief    Sets the pin's previous value and recalculates
+              the on-change thresholds around it, so the
+              per-reading check is two integer compares.
     @param    pin
-              The desired analog pin to calculate hysteresis for.
+              The analog pin.
     @param    pinValRaw
               The pin's raw value.
-    @param    pinValThreshHi
-              The pin's high threshold value.
-    @param    pinValThreshLow
-              The pin's low threshold value.
 */
 /**********************************************************/
-void calculateHysteresis(analogInputPin pin, uint16_t pinValRaw,
-                         uint16_t &pinValThreshHi, uint16_t &pinValThreshLow) {
+void calculateHysteresis(analogInputPin &pin, uint16_t pinValRaw) {
   // All boards ADC values scaled to 16bit, in future we may need to
   // adjust dynamically
-  uint16_t maxDecimalValue = 65535;
+  const uint16_t maxDecimalValue = 65535;
+  // Folded to integer constants at compile time
+  const uint16_t hysteresis = (uint16_t)(maxDecimalValue * DEFAULT_HYSTERISIS);
 
   // Calculate threshold values - using DEFAULT_HYSTERISIS for first third
   // (1/3) of the range, then 2x DEFAULT_HYSTERISIS for the middle 1/3,
   // and 4x DEFAULT_HYSTERISIS for the last 1/3. This should allow a more
   // wifi blip tolerant threshold for the both ends of the range.
-  float CURRENT_HYSTERISIS;
+  int32_t curHysteresis;
   if (pinValRaw < maxDecimalValue / 3) {
-    CURRENT_HYSTERISIS = maxDecimalValue * DEFAULT_HYSTERISIS;
+    curHysteresis = hysteresis;
   } else if (pinValRaw < (maxDecimalValue / 3) * 2) {
-    CURRENT_HYSTERISIS = maxDecimalValue * DEFAULT_HYSTERISIS * 2;
-  } else {
-    CURRENT_HYSTERISIS = maxDecimalValue * DEFAULT_HYSTERISIS * 4;
-  }
-  // get the threshold values for previous pin value, but don't overflow
-  float overflowableThHi = pin.prvPinVal + CURRENT_HYSTERISIS;
-  float overflowableThLow = pin.prvPinVal - CURRENT_HYSTERISIS;
-  if (overflowableThHi > maxDecimalValue) {
-    pinValThreshHi = maxDecimalValue;
-  } else {
-    pinValThreshHi = overflowableThHi;
-  }
-  if (overflowableThLow < 0) {
-    pinValThreshLow = 0;
+    curHysteresis = hysteresis * 2;
   } else {
-    pinValThreshLow = overflowableThLow;
+    curHysteresis = hysteresis * 4;
   }
+  // get the threshold values for the pin value, but don't overflow
+  int32_t thHi = (int32_t)pinValRaw + curHysteresis;
+  int32_t thLow = (int32_t)pinValRaw - curHysteresis;
+  pin.prvPinVal = pinValRaw;
+  pin.threshHi = thHi > maxDecimalValue ? maxDecimalValue : (uint16_t)thHi;
+  pin.threshLo = thLow < 0 ? 0 : (uint16_t)thLow;
 }
 
 /**********************************************************/
@@ -378,6 +643,34 @@ bool Wippersnapper_AnalogIO::timerExpired(long currentTime, analogInputPin pin,
   return false;
 }
 
+/**********************************************************/
+/*!
+    @brief    Finds when update() next has work to do.
+    @param    curTime
+              Current time, from millis().
+    @returns  Deadline as a millis() timestamp.
+*/
+/**********************************************************/
+unsigned long Wippersnapper_AnalogIO::getNextUpdateTime(unsigned long curTime) {
+  unsigned long nextTime = curTime + WS_SCHEDULER_IDLE_MS;
+  for (int i = 0; i < _totalAnalogInputPins; i++) {
+    if (!_analog_input_pins[i].enabled)
+      continue;
+    // on-change pins are checked every 500ms
+    long period = _analog_input_pins[i].period == 0L
+                      ? 500L
+                      : _analog_input_pins[i].period;
+    nextTime = ws_scheduler::earliest(
+        nextTime, (unsigned long)_analog_input_pins[i].prvPeriod + period + 1);
+    // captured pins drain their ring before it overflows
+    if (_analog_input_pins[i].capture != nullptr)
+      nextTime = ws_scheduler::earliest(
+          nextTime,
+          curTime + _analog_input_pins[i].capture->serviceIntervalMs());
+  }
+  return nextTime;
+}
+
 /**********************************************************/
 /*!
     @brief    Iterates thru analog inputs
@@ -387,11 +680,17 @@ void Wippersnapper_AnalogIO::update() {
   // TODO: Globally scope these, dont have them here every time
   float pinValVolts = 0.0;
   uint16_t pinValRaw = 0;
+  // Collect this pass's events into one message
+  _pinEvents.open();
   // Process analog input pins
   for (int i = 0; i < _totalAnalogInputPins; i++) {
     // TODO: Can we collapse the conditionals below?
     if (_analog_input_pins[i].enabled == true) {
 
+      // Fold captured samples into the pin's window
+      if (_analog_input_pins[i].capture != nullptr)
+        _analog_input_pins[i].capture->poll();
+
       // Does the pin execute on-period?
       if (_analog_input_pins[i].period != 0L &&
           timerExpired(millis(), _analog_input_pins[i])) {
@@ -399,13 +698,19 @@ void Wippersnapper_AnalogIO::update() {
         WS_DEBUG_PRINTLN(_analog_input_pins[i].pinName);
 
         // Read from analog pin
-        if (_analog_input_pins[i].readMode ==
+        if (_analog_input_pins[i].capture != nullptr) {
+          if (!readCapture(_analog_input_pins[i], pinValRaw, pinValVolts)) {
+            _analog_input_pins[i].prvPeriod = millis();
+            continue;
+          }
+        } else if (
+            _analog_input_pins[i].readMode ==
             wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VOLTAGE) {
-          pinValVolts = getPinValueVolts(_analog_input_pins[i].pinName);
+          pinValVolts = readFilteredVolts(_analog_input_pins[i]);
         } else if (
             _analog_input_pins[i].readMode ==
             wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VALUE) {
-          pinValRaw = getPinValue(_analog_input_pins[i].pinName);
+          pinValRaw = readFiltered(_analog_input_pins[i], false);
         } else {
           WS_DEBUG_PRINTLN("ERROR: Unable to read pin value, cannot determine "
                            "analog read mode!");
@@ -430,19 +735,16 @@ void Wippersnapper_AnalogIO::update() {
 
         // note: on-change requires ADC DEFAULT_HYSTERISIS to check against prv
         // pin value
-        uint16_t pinValRaw = getPinValue(_analog_input_pins[i].pinName);
+        uint16_t pinValRaw = readFiltered(_analog_input_pins[i], false);
 
         // check if pin value has changed enough
-        uint16_t pinValThreshHi, pinValThreshLow;
-        calculateHysteresis(_analog_input_pins[i], pinValRaw, pinValThreshHi,
-                            pinValThreshLow);
-
         if (_analog_input_pins[i].prvPeriod == 0 ||
-            pinValRaw > pinValThreshHi || pinValRaw < pinValThreshLow) {
+            pinValRaw > _analog_input_pins[i].threshHi ||
+            pinValRaw < _analog_input_pins[i].threshLo) {
           // Perform voltage conversion if we need to
           if (_analog_input_pins[i].readMode ==
               wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_ANALOG_READ_MODE_PIN_VOLTAGE) {
-            pinValVolts = getPinValueVolts(_analog_input_pins[i].pinName);
+            pinValVolts = readFilteredVolts(_analog_input_pins[i], pinValRaw);
           }
 
           // Publish pin event to IO
@@ -453,12 +755,15 @@ void Wippersnapper_AnalogIO::update() {
           // mark last execution time
           _analog_input_pins[i].prvPeriod = millis();
 
-        } else { // ADC has not changed enough
+        } else { // ADC has not changed enough, check again in 500ms
+          _analog_input_pins[i].prvPeriod = millis();
           continue;
         }
-        // set the pin value in the digital pin object for comparison next run
-        _analog_input_pins[i].prvPinVal = pinValRaw;
+        // set the pin value and thresholds for comparison next run
+        calculateHysteresis(_analog_input_pins[i], pinValRaw);
       }
     }
   }
+
+  _pinEvents.close();
 }
\ No newline at end of file
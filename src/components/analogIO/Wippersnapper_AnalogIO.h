@@ -17,18 +17,56 @@
 #define WIPPERSNAPPER_ANALOGIO_H
 
 #include "Wippersnapper.h"
+#include "ws_adc_capture.h"
 
 #define DEFAULT_HYSTERISIS 0.02 ///< Default DEFAULT_HYSTERISIS of 2%
 
+/** Filter applied to an analog input's ADC samples */
+typedef enum {
+  WS_ANALOG_FILTER_NONE,   ///< One sample per reading
+  WS_ANALOG_FILTER_BOXCAR, ///< Mean of the oversampled readings
+  WS_ANALOG_FILTER_EMA,    ///< Boxcar mean, smoothed across readings
+} ws_analog_filter_t;
+
+#ifndef WS_ANALOG_FILTER
+#define WS_ANALOG_FILTER WS_ANALOG_FILTER_BOXCAR ///< Default input filter
+#endif
+#ifndef WS_ANALOG_OVERSAMPLE
+#define WS_ANALOG_OVERSAMPLE 8 ///< Default ADC samples per reading
+#endif
+#ifndef WS_ANALOG_MEDIAN3
+#define WS_ANALOG_MEDIAN3 false ///< Default for median-of-3 spike rejection
+#endif
+#ifndef WS_ANALOG_EMA_SHIFT
+#define WS_ANALOG_EMA_SHIFT 2 ///< EMA weight of a new reading, 1/2^shift
+#endif
+#ifndef WS_ANALOG_CAPTURE_STAT
+#define WS_ANALOG_CAPTURE_STAT                                                 \
+  WS_ADC_STAT_RMS ///< Statistic reported for continuously captured pins
+#endif
+
+// Periodic inputs on the pins listed in WS_ANALOG_CAPTURE_PINS, such as
+// -DWS_ANALOG_CAPTURE_PINS=1,2, are sampled continuously at
+// WS_ADC_CAPTURE_RATE_HZ and report WS_ANALOG_CAPTURE_STAT over each
+// period instead of a single reading.
+
 /** Data about an analog input pin */
 struct analogInputPin {
   int pinName;  ///< Pin name
   bool enabled; ///< Pin is enabled for sampling
   wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode
-      readMode;    ///< Which type of analog read to perform
-  long period;     ///< Pin timer interval, in millis, -1 if disabled.
-  long prvPeriod;  ///< When Pin's timer was previously serviced, in millis
-  float prvPinVal; ///< Previous pin value
+      readMode;              ///< Which type of analog read to perform
+  long period;               ///< Pin timer interval, in millis, -1 if disabled.
+  long prvPeriod;            ///< When Pin's timer was last serviced, in millis
+  uint16_t prvPinVal;        ///< Previous pin value
+  uint16_t threshHi;         ///< On-change publishes above this value
+  uint16_t threshLo;         ///< On-change publishes below this value
+  ws_analog_filter_t filter; ///< Filter applied to the pin's samples
+  uint8_t oversample;        ///< ADC samples averaged per reading
+  bool median3;              ///< Each sample is the median of three reads
+  uint8_t emaPrimed;         ///< Bit per ema[] entry holding a reading
+  int32_t ema[2];            ///< EMA of raw and millivolt readings, Q24.8
+  ws_adc_capture *capture;   ///< Continuous capture, nullptr if polled
 };
 
 // forward decl.
@@ -59,6 +97,8 @@ public:
 
   uint16_t getPinValue(int pin);
   float getPinValueVolts(int pin);
+  void setInputFilter(int pin, ws_analog_filter_t filter, uint8_t oversample,
+                      bool median3);
 
   void setADCResolution(int resolution);
   int getADCresolution();
@@ -67,12 +107,22 @@ public:
                     long periodOffset = 0);
 
   void update();
+  unsigned long getNextUpdateTime(unsigned long curTime);
   bool encodePinEvent(
       uint8_t pinName,
       wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode readMode,
       uint16_t pinValRaw = 0, float pinValVolts = 0.0);
 
 private:
+  uint16_t readSample(int pin, bool millivolts);
+  uint16_t readFiltered(analogInputPin &pin, bool millivolts);
+  float readFilteredVolts(analogInputPin &pin, int32_t filteredRaw = -1);
+  bool isCapturePin(int pin);
+  void startCapture(analogInputPin &pin);
+  void stopCapture(analogInputPin &pin);
+  bool readCapture(analogInputPin &pin, uint16_t &pinValRaw,
+                   float &pinValVolts);
+
   float _aRef;           /*!< Hardware's reported voltage reference */
   int _adcResolution;    /*!< Resolution returned by the analogRead() funcn. */
   int _nativeResolution; /*!< Hardware's native ADC resolution. */
@@ -80,6 +130,7 @@ private:
                                    returned by analogRead(). */
   int32_t _totalAnalogInputPins;      /*!< Total number of analog input pins */
   analogInputPin *_analog_input_pins; /*!< Array of analog pin objects */
+  ws_pin_event_batch _pinEvents;      /*!< Events queued by update() */
 };
 extern Wippersnapper WS; /*!< Wippersnapper variable. */
 
@@ -0,0 +1,447 @@
+/*!
+ * @file ws_adc_capture.cpp
+ *
+ * Continuous capture of a high-rate analog input.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_adc_capture.h"
+#include "Wippersnapper.h"
+
+#ifdef WS_ADC_CAPTURE_ESP32
+#include "esp_adc/adc_continuous.h"
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define WS_ADC_OUTPUT_FORMAT ADC_DIGI_OUTPUT_FORMAT_TYPE1 ///< Result layout
+#define WS_ADC_OUTPUT_DATA(p) ((p)->type1.data) ///< Sample in a result
+#else
+#define WS_ADC_OUTPUT_FORMAT ADC_DIGI_OUTPUT_FORMAT_TYPE2 ///< Result layout
+#define WS_ADC_OUTPUT_DATA(p) ((p)->type2.data) ///< Sample in a result
+#endif
+#define WS_ADC_FRAME_SAMPLES 64 ///< Samples per DMA conversion frame
+
+/**************************************************************************/
+/*!
+    @brief  Samples with the ESP32 ADC continuous driver, which DMAs
+            conversions into its own buffer in the background. Only ADC1
+            pins can be captured, and while capturing, analogRead() of
+            other ADC1 pins fails as the driver holds the unit.
+*/
+/**************************************************************************/
+class ws_adc_source_esp32 : public ws_adc_source {
+public:
+  ~ws_adc_source_esp32() { end(); }
+
+  /************************************************************************/
+  /*!
+      @brief    Configures the driver for one pin and starts conversions.
+                Rates below the hardware's minimum are sampled at the
+                minimum and decimated by averaging.
+      @param    pin
+                Analog pin to sample.
+      @param    rateHz
+                Sample rate, in Hz.
+      @param    ring
+                Ring to fill with samples scaled to 16 bits.
+      @returns  True if sampling started.
+  */
+  /************************************************************************/
+  bool begin(uint8_t pin, uint32_t rateHz, ws_adc_ring *ring) override {
+    if (_handle != nullptr || rateHz == 0 ||
+        rateHz > SOC_ADC_SAMPLE_FREQ_THRES_HIGH)
+      return false;
+    adc_unit_t unit;
+    adc_channel_t channel;
+    if (adc_continuous_io_to_channel(pin, &unit, &channel) != ESP_OK ||
+        unit != ADC_UNIT_1) {
+      WS_DEBUG_PRINTLN("ERROR: Continuous capture requires an ADC1 pin");
+      return false;
+    }
+    _decimate = (SOC_ADC_SAMPLE_FREQ_THRES_LOW + rateHz - 1) / rateHz;
+    if (_decimate == 0)
+      _decimate = 1;
+
+    adc_continuous_handle_cfg_t handleCfg = {};
+    handleCfg.max_store_buf_size =
+        WS_ADC_CAPTURE_RING_LEN * _decimate * SOC_ADC_DIGI_RESULT_BYTES;
+    handleCfg.conv_frame_size =
+        WS_ADC_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES;
+    if (adc_continuous_new_handle(&handleCfg, &_handle) != ESP_OK) {
+      _handle = nullptr;
+      return false;
+    }
+
+    adc_digi_pattern_config_t pattern = {};
+    pattern.atten = ADC_ATTEN_DB_12;
+    pattern.channel = (uint8_t)channel;
+    pattern.unit = (uint8_t)unit;
+    pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    adc_continuous_config_t cfg = {};
+    cfg.pattern_num = 1;
+    cfg.adc_pattern = &pattern;
+    cfg.sample_freq_hz = rateHz * _decimate;
+    cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    cfg.format = WS_ADC_OUTPUT_FORMAT;
+    if (adc_continuous_config(_handle, &cfg) != ESP_OK ||
+        adc_continuous_start(_handle) != ESP_OK) {
+      adc_continuous_deinit(_handle);
+      _handle = nullptr;
+      return false;
+    }
+    _ring = ring;
+    _acc = 0;
+    _accCount = 0;
+    return true;
+  }
+
+  /************************************************************************/
+  /*!
+      @brief    Stops conversions and releases the driver.
+  */
+  /************************************************************************/
+  void end() override {
+    if (_handle == nullptr)
+      return;
+    adc_continuous_stop(_handle);
+    adc_continuous_deinit(_handle);
+    _handle = nullptr;
+  }
+
+  /************************************************************************/
+  /*!
+      @brief    Moves the conversions the driver buffered into the ring.
+  */
+  /************************************************************************/
+  void service() override {
+    if (_handle == nullptr)
+      return;
+    uint8_t buf[WS_ADC_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES];
+    uint32_t len = 0;
+    while (adc_continuous_read(_handle, buf, sizeof(buf), &len, 0) == ESP_OK) {
+      for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= len;
+           i += SOC_ADC_DIGI_RESULT_BYTES) {
+        adc_digi_output_data_t *result = (adc_digi_output_data_t *)&buf[i];
+        _acc += WS_ADC_OUTPUT_DATA(result);
+        if (++_accCount < _decimate)
+          continue;
+        _ring->push((uint16_t)((_acc / _decimate)
+                               << (16 - SOC_ADC_DIGI_MAX_BITWIDTH)));
+        _acc = 0;
+        _accCount = 0;
+      }
+    }
+  }
+
+private:
+  adc_continuous_handle_t _handle = nullptr; ///< Driver instance
+  ws_adc_ring *_ring = nullptr;              ///< Ring being filled
+  uint32_t _decimate = 1;                    ///< Conversions per sample
+  uint32_t _acc = 0;                         ///< Sum of pending conversions
+  uint32_t _accCount = 0;                    ///< Pending conversions
+};
+
+#elif defined(WS_NATIVE)
+
+/**************************************************************************/
+/*!
+    @brief  Host build source, samples the simulated pin's waveform (see
+            ws_native_set_analog_wave()) at each sample time that passed
+            on the virtual clock, as if a DMA engine had been filling the
+            ring since the last loop pass.
+*/
+/**************************************************************************/
+class ws_adc_source_synthetic : public ws_adc_source {
+public:
+  /************************************************************************/
+  /*!
+      @brief    Starts sampling a pin from the current virtual time.
+      @param    pin
+                Analog pin to sample.
+      @param    rateHz
+                Sample rate, in Hz.
+      @param    ring
+                Ring to fill with samples scaled to 16 bits.
+      @returns  True if sampling started.
+  */
+  /************************************************************************/
+  bool begin(uint8_t pin, uint32_t rateHz, ws_adc_ring *ring) override {
+    if (rateHz == 0 || rateHz > 1000000UL)
+      return false;
+    _pin = pin;
+    _periodUs = 1000000UL / rateHz;
+    _nextUs = ws_native_now_us();
+    _ring = ring;
+    return true;
+  }
+
+  /************************************************************************/
+  /*!
+      @brief    Stops sampling.
+  */
+  /************************************************************************/
+  void end() override { _ring = nullptr; }
+
+  /************************************************************************/
+  /*!
+      @brief    Produces every sample due since the last call.
+  */
+  /************************************************************************/
+  void service() override {
+    if (_ring == nullptr)
+      return;
+    uint64_t now = ws_native_now_us();
+    for (; _nextUs <= now; _nextUs += _periodUs)
+      _ring->push((uint16_t)(ws_native_analog_at(_pin, _nextUs) << 6));
+  }
+
+private:
+  ws_adc_ring *_ring = nullptr; ///< Ring being filled
+  uint64_t _nextUs = 0;         ///< Virtual time of the next sample
+  uint32_t _periodUs = 0;       ///< Time between samples, in micros
+  uint8_t _pin = 0;             ///< Pin being sampled
+};
+
+#else
+
+/**************************************************************************/
+/*!
+    @brief  Fallback for boards without a continuous ADC driver, takes at
+            most one analogRead() per loop pass, so the achievable rate is
+            bounded by the loop.
+*/
+/**************************************************************************/
+class ws_adc_source_poll : public ws_adc_source {
+public:
+  /************************************************************************/
+  /*!
+      @brief    Creates a polled source.
+      @param    readBits
+                Resolution analogRead() returns, in bits.
+  */
+  /************************************************************************/
+  ws_adc_source_poll(uint8_t readBits) : _readBits(readBits) {}
+
+  /************************************************************************/
+  /*!
+      @brief    Starts sampling a pin.
+      @param    pin
+                Analog pin to sample.
+      @param    rateHz
+                Sample rate, in Hz.
+      @param    ring
+                Ring to fill with samples scaled to 16 bits.
+      @returns  True if sampling started.
+  */
+  /************************************************************************/
+  bool begin(uint8_t pin, uint32_t rateHz, ws_adc_ring *ring) override {
+    if (rateHz == 0 || rateHz > 1000000UL)
+      return false;
+    _pin = pin;
+    _periodUs = 1000000UL / rateHz;
+    _nextUs = micros();
+    _ring = ring;
+    return true;
+  }
+
+  /************************************************************************/
+  /*!
+      @brief    Stops sampling.
+  */
+  /************************************************************************/
+  void end() override { _ring = nullptr; }
+
+  /************************************************************************/
+  /*!
+      @brief    Reads a sample if one is due.
+  */
+  /************************************************************************/
+  void service() override {
+    unsigned long now = micros();
+    if (_ring == nullptr || (long)(now - _nextUs) < 0)
+      return;
+    uint16_t sample = analogRead(_pin);
+    if (_readBits < 16)
+      sample <<= 16 - _readBits;
+    else
+      sample >>= _readBits - 16;
+    _ring->push(sample);
+    _nextUs = now + _periodUs;
+  }
+
+private:
+  ws_adc_ring *_ring = nullptr; ///< Ring being filled
+  unsigned long _nextUs = 0;    ///< micros() when the next sample is due
+  uint32_t _periodUs = 0;       ///< Time between samples, in micros
+  uint8_t _pin = 0;             ///< Pin being sampled
+  uint8_t _readBits;            ///< Resolution analogRead() returns
+};
+
+#endif
+
+/**************************************************************************/
+/*!
+    @brief    Creates the best sample source this board supports.
+    @param    readBits
+              Resolution analogRead() returns, in bits, used by boards
+              which fall back to polling.
+    @returns  New source, owned by the caller.
+*/
+/**************************************************************************/
+ws_adc_source *ws_adc_source::create(uint8_t readBits) {
+#ifdef WS_ADC_CAPTURE_ESP32
+  (void)readBits;
+  return new ws_adc_source_esp32();
+#elif defined(WS_NATIVE)
+  (void)readBits;
+  return new ws_adc_source_synthetic();
+#else
+  return new ws_adc_source_poll(readBits);
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Adds a sample to the window.
+    @param    sample
+              Sample, in 16-bit ADC counts.
+*/
+/**************************************************************************/
+void ws_adc_window::add(uint16_t sample) {
+  _count++;
+  _sum += sample;
+  _sumSq += (uint32_t)sample * sample;
+  if (sample < _min)
+    _min = sample;
+  if (sample > _max)
+    _max = sample;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reduces the window to its statistics.
+    @param    stats
+              Filled with the window's statistics.
+    @param    lost
+              Samples lost from the window, reported in stats.
+    @returns  True if the window holds any samples.
+*/
+/**************************************************************************/
+bool ws_adc_window::stats(ws_adc_stats_t &stats, uint32_t lost) {
+  stats.count = _count;
+  stats.lost = lost;
+  if (_count == 0)
+    return false;
+  // Double keeps sumSq / count - mean^2 from cancelling to noise
+  double mean = (double)_sum / _count;
+  double variance = (double)_sumSq / _count - mean * mean;
+  stats.mean = (float)mean;
+  stats.rms = variance > 0 ? (float)sqrt(variance) : 0;
+  stats.min = _min;
+  stats.max = _max;
+  stats.p2p = _max - _min;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Empties the window.
+*/
+/**************************************************************************/
+void ws_adc_window::reset() {
+  _count = 0;
+  _sum = 0;
+  _sumSq = 0;
+  _min = UINT16_MAX;
+  _max = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Creates a capture.
+    @param    source
+              Sample source, owned and deleted by the capture.
+*/
+/**************************************************************************/
+ws_adc_capture::ws_adc_capture(ws_adc_source *source) : _source(source) {}
+
+/**************************************************************************/
+/*!
+    @brief    Stops the capture and deletes its source.
+*/
+/**************************************************************************/
+ws_adc_capture::~ws_adc_capture() {
+  if (_running)
+    _source->end();
+  delete _source;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Starts capturing a pin.
+    @param    pin
+              Analog pin to capture.
+    @param    rateHz
+              Sample rate, in Hz.
+    @returns  True if the capture started.
+*/
+/**************************************************************************/
+bool ws_adc_capture::begin(uint8_t pin, uint32_t rateHz) {
+  if (_running)
+    return false;
+  _ring.clear();
+  _window.reset();
+  _rateHz = rateHz;
+  _running = _source->begin(pin, rateHz, &_ring);
+  return _running;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Folds the samples buffered since the last call into the
+              window. Must be called at least every serviceIntervalMs().
+*/
+/**************************************************************************/
+void ws_adc_capture::poll() {
+  if (!_running)
+    return;
+  _source->service();
+  uint16_t sample;
+  while (_ring.pop(sample))
+    _window.add(sample);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reports the window captured since the last call and starts a
+              new one.
+    @param    stats
+              Filled with the window's statistics.
+    @returns  True if the window held any samples.
+*/
+/**************************************************************************/
+bool ws_adc_capture::takeStats(ws_adc_stats_t &stats) {
+  poll();
+  bool ok = _window.stats(stats, _ring.takeLost());
+  _window.reset();
+  return ok;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Returns how often poll() must run to keep the ring from
+              overflowing, with half the ring as margin.
+    @returns  Interval, in millis.
+*/
+/**************************************************************************/
+unsigned long ws_adc_capture::serviceIntervalMs() const {
+  if (_rateHz == 0)
+    return WS_SCHEDULER_IDLE_MS;
+  unsigned long ms = WS_ADC_CAPTURE_RING_LEN * 500UL / _rateHz;
+  return ms > 0 ? ms : 1;
+}
@@ -0,0 +1,218 @@
+/*!
+ * @file ws_adc_capture.h
+ *
+ * Continuous capture of a high-rate analog input. A sample source fills a
+ * ring buffer in the background (the ESP32 ADC continuous driver, or a
+ * synthetic waveform on the host) and the application loop folds the ring
+ * into a window whose statistics are reported once per period, rather
+ * than calling analogRead() for every sample.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_ADC_CAPTURE_H
+#define WS_ADC_CAPTURE_H
+
+#include "Arduino.h"
+
+#ifndef WS_ADC_CAPTURE_RING_LEN
+#define WS_ADC_CAPTURE_RING_LEN                                                \
+  512 ///< Samples buffered between loop passes, must be a power of two
+#endif
+#ifndef WS_ADC_CAPTURE_RATE_HZ
+#define WS_ADC_CAPTURE_RATE_HZ 4000 ///< Default capture sample rate
+#endif
+
+// Continuous capture is used by hardware which can sample in the
+// background, other boards fall back to sampling once per loop pass.
+#if defined(ARDUINO_ARCH_ESP32) && defined(ESP_ARDUINO_VERSION_MAJOR) &&       \
+    ESP_ARDUINO_VERSION_MAJOR >= 3
+#include "soc/soc_caps.h"
+#if SOC_ADC_DMA_SUPPORTED
+#define WS_ADC_CAPTURE_ESP32 ///< Capture with the ADC continuous driver
+#endif
+#endif
+
+/** Statistic reported for a captured window */
+typedef enum {
+  WS_ADC_STAT_MEAN, ///< Mean of the window's samples
+  WS_ADC_STAT_RMS,  ///< RMS of the samples about their mean
+  WS_ADC_STAT_MIN,  ///< Smallest sample
+  WS_ADC_STAT_MAX,  ///< Largest sample
+  WS_ADC_STAT_P2P,  ///< Peak-to-peak, max - min
+} ws_adc_stat_t;
+
+/** Statistics of a captured window, in 16-bit ADC counts */
+typedef struct {
+  uint32_t count; ///< Samples in the window
+  uint32_t lost;  ///< Samples dropped because the ring was full
+  float mean;     ///< Mean of the samples
+  float rms;      ///< RMS of the samples about the mean, the AC component
+  uint16_t min;   ///< Smallest sample
+  uint16_t max;   ///< Largest sample
+  uint16_t p2p;   ///< Peak-to-peak, max - min
+} ws_adc_stats_t;
+
+/**************************************************************************/
+/*!
+    @brief  Single-producer, single-consumer ring of 16-bit samples. The
+            producer may run in an interrupt, the consumer is the loop.
+*/
+/**************************************************************************/
+class ws_adc_ring {
+public:
+  /************************************************************************/
+  /*!
+      @brief    Adds a sample, or counts it as lost if the ring is full.
+      @param    sample
+                Sample, scaled to 16 bits.
+  */
+  /************************************************************************/
+  void push(uint16_t sample) {
+    uint16_t head = _head;
+    if ((uint16_t)(head - _tail) >= WS_ADC_CAPTURE_RING_LEN) {
+      _lost++;
+      return;
+    }
+    _buf[head & (WS_ADC_CAPTURE_RING_LEN - 1)] = sample;
+    _head = head + 1;
+  }
+  /************************************************************************/
+  /*!
+      @brief    Removes the oldest sample.
+      @param    sample
+                Oldest sample.
+      @returns  True if a sample was removed, False if the ring is empty.
+  */
+  /************************************************************************/
+  bool pop(uint16_t &sample) {
+    uint16_t tail = _tail;
+    if (tail == _head)
+      return false;
+    sample = _buf[tail & (WS_ADC_CAPTURE_RING_LEN - 1)];
+    _tail = tail + 1;
+    return true;
+  }
+  /************************************************************************/
+  /*!
+      @brief    Returns and clears the count of lost samples.
+      @returns  Samples lost since the last call.
+  */
+  /************************************************************************/
+  uint32_t takeLost() {
+    uint32_t lost = _lost;
+    _lost -= lost;
+    return lost;
+  }
+  /************************************************************************/
+  /*!
+      @brief    Discards every buffered sample.
+  */
+  /************************************************************************/
+  void clear() { _tail = _head; }
+
+private:
+  uint16_t _buf[WS_ADC_CAPTURE_RING_LEN]; ///< Sample storage
+  volatile uint16_t _head = 0;            ///< Free-running write index
+  volatile uint16_t _tail = 0;            ///< Free-running read index
+  volatile uint32_t _lost = 0;            ///< Samples dropped when full
+};
+
+/**************************************************************************/
+/*!
+    @brief  Accumulates samples and reduces them to ws_adc_stats_t with
+            integer sums, so adding a sample costs no floating point.
+*/
+/**************************************************************************/
+class ws_adc_window {
+public:
+  ws_adc_window() { reset(); }
+  void add(uint16_t sample);
+  bool stats(ws_adc_stats_t &stats, uint32_t lost = 0);
+  void reset();
+  /************************************************************************/
+  /*!
+      @brief    Returns the number of samples in the window.
+      @returns  Sample count.
+  */
+  /************************************************************************/
+  uint32_t count() const { return _count; }
+
+private:
+  uint32_t _count; ///< Samples added since reset()
+  uint64_t _sum;   ///< Sum of the samples
+  uint64_t _sumSq; ///< Sum of the squared samples
+  uint16_t _min;   ///< Smallest sample
+  uint16_t _max;   ///< Largest sample
+};
+
+/**************************************************************************/
+/*!
+    @brief  Produces an analog pin's samples into a ws_adc_ring at a fixed
+            rate.
+*/
+/**************************************************************************/
+class ws_adc_source {
+public:
+  virtual ~ws_adc_source() {}
+  /************************************************************************/
+  /*!
+      @brief    Starts sampling a pin.
+      @param    pin
+                Analog pin to sample.
+      @param    rateHz
+                Sample rate, in Hz.
+      @param    ring
+                Ring to fill with samples scaled to 16 bits.
+      @returns  True if sampling started.
+  */
+  /************************************************************************/
+  virtual bool begin(uint8_t pin, uint32_t rateHz, ws_adc_ring *ring) = 0;
+  /************************************************************************/
+  /*!
+      @brief    Stops sampling.
+  */
+  /************************************************************************/
+  virtual void end() = 0;
+  /************************************************************************/
+  /*!
+      @brief    Called from the loop to move samples the hardware buffered
+                into the ring.
+  */
+  /************************************************************************/
+  virtual void service() {}
+
+  static ws_adc_source *create(uint8_t readBits);
+};
+
+/**************************************************************************/
+/*!
+    @brief  Continuously captures one analog pin and reports windowed
+            statistics.
+*/
+/**************************************************************************/
+class ws_adc_capture {
+public:
+  ws_adc_capture(ws_adc_source *source);
+  ~ws_adc_capture();
+
+  bool begin(uint8_t pin, uint32_t rateHz = WS_ADC_CAPTURE_RATE_HZ);
+  void poll();
+  bool takeStats(ws_adc_stats_t &stats);
+  unsigned long serviceIntervalMs() const;
+
+private:
+  ws_adc_source *_source; ///< Sample source, owned
+  ws_adc_ring _ring;      ///< Samples awaiting poll()
+  ws_adc_window _window;  ///< Samples since the last takeStats()
+  uint32_t _rateHz = 0;   ///< Sample rate, in Hz
+  bool _running = false;  ///< True once begin() succeeded
+};
+
+#endif // WS_ADC_CAPTURE_H
@@ -16,6 +16,21 @@
 
 #include "Wippersnapper_DigitalGPIO.h"
 
+void (*const Wippersnapper_DigitalGPIO::_irqHandlers[WS_DIGITAL_IRQ_PINS])() =
+    {isrEdge<0>, isrEdge<1>, isrEdge<2>, isrEdge<3>,
+     isrEdge<4>, isrEdge<5>, isrEdge<6>, isrEdge<7>};
+volatile uint8_t
+    Wippersnapper_DigitalGPIO::_irqPinNames[WS_DIGITAL_IRQ_PINS] = {0};
+volatile bool
+    Wippersnapper_DigitalGPIO::_irqCounting[WS_DIGITAL_IRQ_PINS] = {false};
+volatile uint32_t
+    Wippersnapper_DigitalGPIO::_irqCounts[WS_DIGITAL_IRQ_PINS] = {0};
+volatile digitalInputEdge
+    Wippersnapper_DigitalGPIO::_edges[WS_DIGITAL_EDGE_QUEUE_LEN];
+volatile uint8_t Wippersnapper_DigitalGPIO::_edgeHead = 0;
+volatile uint8_t Wippersnapper_DigitalGPIO::_edgeTail = 0;
+volatile uint16_t Wippersnapper_DigitalGPIO::_edgesDropped = 0;
+
 /***********************************************************************************/
 /*!
     @brief  Initializes DigitalGPIO class.
@@ -33,7 +48,14 @@ Wippersnapper_DigitalGPIO::Wippersnapper_DigitalGPIO(
     _digital_input_pins[i].period = -1;
     _digital_input_pins[i].prvPeriod = 0L;
     _digital_input_pins[i].prvPinVal = 0;
+    _digital_input_pins[i].rawVal = 0;
+    _digital_input_pins[i].rawSince = 0;
+    _digital_input_pins[i].irqSlot = -1;
+    _digital_input_pins[i].port = WS_DIGITAL_NO_PORT;
+    _digital_input_pins[i].portMask = 0;
   }
+  for (int i = 0; i < WS_DIGITAL_IRQ_PINS; i++)
+    _irqInputs[i] = -1;
 }
 
 /*********************************************************/
@@ -42,6 +64,8 @@ Wippersnapper_DigitalGPIO::Wippersnapper_DigitalGPIO(
 */
 /*********************************************************/
 Wippersnapper_DigitalGPIO::~Wippersnapper_DigitalGPIO() {
+  for (int i = 0; i < _totalDigitalInputPins; i++)
+    detachPinInterrupt(i);
   delete _digital_input_pins;
 }
 
@@ -125,6 +149,12 @@ void Wippersnapper_DigitalGPIO::initDigitalPin(
         _digital_input_pins[i].pinName = pinName;
         _digital_input_pins[i].period = periodMs;
         _digital_input_pins[i].prvPeriod = curTime - periodMs;
+        mapPinToPort(_digital_input_pins[i]);
+        // On-change pins are captured by interrupt where the pin has one
+        if (periodMs == 0L)
+          attachPinInterrupt(i, false);
+        else if (isCounterPin(pinName) && !attachPinInterrupt(i, true))
+          WS_DEBUG_PRINTLN("ERROR: Unable to count pulses, reading level");
         break;
       }
     }
@@ -160,10 +190,12 @@ void Wippersnapper_DigitalGPIO::deinitDigitalPin(
     // de-allocate the pin within digital_input_pins[]
     for (int i = 0; i < _totalDigitalInputPins; i++) {
       if (_digital_input_pins[i].pinName == pinName) {
+        detachPinInterrupt(i);
         _digital_input_pins[i].pinName = -1;
         _digital_input_pins[i].period = -1;
         _digital_input_pins[i].prvPeriod = 0L;
         _digital_input_pins[i].prvPinVal = 0;
+        _digital_input_pins[i].rawVal = 0;
         break;
       }
     }
@@ -228,6 +260,46 @@ void Wippersnapper_DigitalGPIO::digitalWriteSvc(uint8_t pinName, int pinValue) {
 #endif
 }
 
+/**********************************************************/
+/*!
+    @brief    Encodes a pinEvent message and queues it for
+              publishing.
+    @param    pinName
+              The pin's name.
+    @param    pinVal
+              The pin's value.
+    @returns  True if the pinEvent was queued, False if it
+              could not be encoded.
+*/
+/**********************************************************/
+bool Wippersnapper_DigitalGPIO::queuePinEvent(uint8_t pinName, int pinVal) {
+  // Create new signal message
+  wippersnapper_signal_v1_CreateSignalRequest _outgoingSignalMsg =
+      wippersnapper_signal_v1_CreateSignalRequest_init_zero;
+
+  // Within processDigitalInputs() events are published together
+  if (_pinEvents.isOpen()) {
+    WS.fillPinEvent(&_outgoingSignalMsg, pinName, pinVal);
+    return _pinEvents.add(_outgoingSignalMsg, WS_PUBLISH_KEY_NONE);
+  }
+
+  WS_DEBUG_PRINT("Encoding pinEvent...");
+  // Create and encode a pinEvent message
+  size_t msgSz = WS.encodePinEvent(&_outgoingSignalMsg, pinName, pinVal);
+  if (msgSz == 0) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to encode pinEvent");
+    return false;
+  }
+  WS_DEBUG_PRINTLN("Encoded!");
+
+  // Every reading is delivered, so these are never coalesced
+  WS_DEBUG_PRINT("Queueing pinEvent...");
+  WS._publishQueue->enqueue(WS._topic_signal_device, WS._buffer_outgoing,
+                            msgSz, 1);
+  WS_DEBUG_PRINTLN("Queued!");
+  return true;
+}
+
 /**********************************************************/
 /*!
     @brief    Iterates thru digital inputs, checks if they
@@ -235,6 +307,15 @@ void Wippersnapper_DigitalGPIO::digitalWriteSvc(uint8_t pinName, int pinValue) {
 */
 /**********************************************************/
 void Wippersnapper_DigitalGPIO::processDigitalInputs() {
+  // Collect this pass's events into one message
+  _pinEvents.open();
+
+  // Publish edges captured by interrupt since the last pass
+  processEdges();
+
+  // Each port's input register is read at most once per pass
+  _portsRead = 0;
+
   long curTime = millis();
   // Process digital digital pins
   for (int i = 0; i < _totalDigitalInputPins; i++) {
@@ -246,8 +327,12 @@ void Wippersnapper_DigitalGPIO::processDigitalInputs() {
           _digital_input_pins[i].period != 0L) {
         WS_DEBUG_PRINT("Executing periodic event on D");
         WS_DEBUG_PRINTLN(_digital_input_pins[i].pinName);
-        // read the pin
-        int pinVal = digitalReadSvc(_digital_input_pins[i].pinName);
+        // read the pin, or the pulses counted since the last period
+        int pinVal;
+        if (_digital_input_pins[i].irqSlot >= 0)
+          pinVal = (int)takePulseCount(_digital_input_pins[i].irqSlot);
+        else
+          pinVal = readInput(_digital_input_pins[i]);
 
 #ifdef USE_DISPLAY
         char buffer[100];
@@ -256,36 +341,23 @@ void Wippersnapper_DigitalGPIO::processDigitalInputs() {
         WS._ui_helper->add_text_to_terminal(buffer);
 #endif
 
-        // Create new signal message
-        wippersnapper_signal_v1_CreateSignalRequest _outgoingSignalMsg =
-            wippersnapper_signal_v1_CreateSignalRequest_init_zero;
-
-        WS_DEBUG_PRINT("Encoding...")
-        // Create and encode a pinEvent message
-        if (!WS.encodePinEvent(&_outgoingSignalMsg,
-                               _digital_input_pins[i].pinName, pinVal)) {
-          WS_DEBUG_PRINTLN("ERROR: Unable to encode pinEvent");
+        if (!queuePinEvent(_digital_input_pins[i].pinName, pinVal))
           break;
-        }
-        WS_DEBUG_PRINTLN("Encoded!")
-
-        // Obtain size and only write out buffer to end
-        size_t msgSz;
-        pb_get_encoded_size(&msgSz,
-                            wippersnapper_signal_v1_CreateSignalRequest_fields,
-                            &_outgoingSignalMsg);
-
-        WS_DEBUG_PRINT("Publishing pinEvent...");
-        WS.publish(WS._topic_signal_device, WS._buffer_outgoing, msgSz, 1);
-        WS_DEBUG_PRINTLN("Published!");
 
         // reset the digital pin
         _digital_input_pins[i].prvPeriod = curTime;
       } else if (_digital_input_pins[i].period == 0L) {
-        // read pin
-        int pinVal = digitalReadSvc(_digital_input_pins[i].pinName);
-        // only send on-change
-        if (pinVal != _digital_input_pins[i].prvPinVal) {
+        // read pin, interrupt-driven pins were fed by processEdges()
+        if (_digital_input_pins[i].irqSlot < 0) {
+          int rawVal = readInput(_digital_input_pins[i]);
+          if (rawVal != _digital_input_pins[i].rawVal) {
+            _digital_input_pins[i].rawVal = rawVal;
+            _digital_input_pins[i].rawSince = micros();
+          }
+        }
+        // only send on-change, once the new level has settled
+        if (isSettled(_digital_input_pins[i], micros())) {
+          int pinVal = _digital_input_pins[i].rawVal;
           WS_DEBUG_PRINT("Executing state-based event on D");
           WS_DEBUG_PRINTLN(_digital_input_pins[i].pinName);
 
@@ -296,27 +368,8 @@ void Wippersnapper_DigitalGPIO::processDigitalInputs() {
           WS._ui_helper->add_text_to_terminal(buffer);
 #endif
 
-          // Create new signal message
-          wippersnapper_signal_v1_CreateSignalRequest _outgoingSignalMsg =
-              wippersnapper_signal_v1_CreateSignalRequest_init_zero;
-
-          WS_DEBUG_PRINT("Encoding pinEvent...");
-          // Create and encode a pinEvent message
-          if (!WS.encodePinEvent(&_outgoingSignalMsg,
-                                 _digital_input_pins[i].pinName, pinVal)) {
-            WS_DEBUG_PRINTLN("ERROR: Unable to encode pinEvent");
+          if (!queuePinEvent(_digital_input_pins[i].pinName, pinVal))
             break;
-          }
-          WS_DEBUG_PRINTLN("Encoded!");
-
-          // Obtain size and only write out buffer to end
-          size_t msgSz;
-          pb_get_encoded_size(
-              &msgSz, wippersnapper_signal_v1_CreateSignalRequest_fields,
-              &_outgoingSignalMsg);
-          WS_DEBUG_PRINT("Publishing pinEvent...");
-          WS.publish(WS._topic_signal_device, WS._buffer_outgoing, msgSz, 1);
-          WS_DEBUG_PRINTLN("Published!");
 
           // set the pin value in the digital pin object for comparison on next
           // run
@@ -328,4 +381,309 @@ void Wippersnapper_DigitalGPIO::processDigitalInputs() {
       }
     }
   }
-}
\ No newline at end of file
+
+  _pinEvents.close();
+}
+
+/**********************************************************/
+/*!
+    @brief    Publishes the edges captured by interrupt, in
+              the order they occurred.
+*/
+/**********************************************************/
+void Wippersnapper_DigitalGPIO::processEdges() {
+  if (_edgesDropped > 0) {
+    WS_DEBUG_PRINT("WARNING: Edge queue full, lost ");
+    WS_DEBUG_PRINT(_edgesDropped);
+    WS_DEBUG_PRINTLN(" digital input edges");
+    noInterrupts();
+    _edgesDropped = 0;
+    interrupts();
+  }
+
+  while (_edgeHead != _edgeTail) {
+    uint8_t head = _edgeHead;
+    uint8_t slot = _edges[head].irqSlot;
+    int pinVal = _edges[head].pinVal;
+    unsigned long timestamp = _edges[head].timestamp;
+
+    // Skip edges of a pin deinitialized since they were captured
+    int i = _irqInputs[slot];
+    if (i < 0) {
+      _edgeHead = (head + 1) % WS_DIGITAL_EDGE_QUEUE_LEN;
+      continue;
+    }
+    digitalInputPin &pin = _digital_input_pins[i];
+
+    WS_DEBUG_PRINT("Executing edge event on D");
+    WS_DEBUG_PRINT(pin.pinName);
+    WS_DEBUG_PRINT(" at ");
+    WS_DEBUG_PRINT(timestamp);
+    WS_DEBUG_PRINTLN("us");
+    _edgeHead = (head + 1) % WS_DIGITAL_EDGE_QUEUE_LEN;
+
+    // Each edge restarts the settle time, processDigitalInputs() publishes
+    // the level once it has held for WS_DIGITAL_DEBOUNCE_MS
+    pin.rawVal = pinVal;
+    pin.rawSince = timestamp;
+    if (WS_DIGITAL_DEBOUNCE_MS > 0)
+      continue;
+
+#ifdef USE_DISPLAY
+    char buffer[100];
+    snprintf(buffer, 100, "[Pin] Read D%u: %d\n", pin.pinName, pinVal);
+    WS._ui_helper->add_text_to_terminal(buffer);
+#endif
+
+    // Without debouncing every edge is published. Each interrupt is a level
+    // change, so a repeated value means the pin pulsed and settled back
+    // before the handler could read it
+    if (pinVal == pin.prvPinVal && !queuePinEvent(pin.pinName, !pinVal))
+      break;
+    if (!queuePinEvent(pin.pinName, pinVal))
+      break;
+    pin.prvPinVal = pinVal;
+    pin.prvPeriod = millis();
+  }
+}
+
+/**********************************************************/
+/*!
+    @brief    Finds the GPIO port register holding a digital
+              input's level, so polled inputs sharing a port
+              are read together.
+    @param    pin
+              The digital input pin.
+*/
+/**********************************************************/
+void Wippersnapper_DigitalGPIO::mapPinToPort(digitalInputPin &pin) {
+  pin.port = WS_DIGITAL_NO_PORT;
+#ifdef WS_DIGITAL_PORT_READS
+#if defined(ARDUINO_ARCH_ESP8266)
+  // GPIO16 is not part of the GPI register
+  if (pin.pinName == 16)
+    return;
+#endif
+  // Pins without a port, NOT_A_PIN on AVR, have no input register
+  ws_port_reg_t reg = portInputRegister(digitalPinToPort(pin.pinName));
+  if (reg == nullptr)
+    return;
+  uint8_t port = 0;
+  while (port < _numPorts && _portRegs[port] != reg)
+    port++;
+  if (port == WS_DIGITAL_MAX_PORTS)
+    return; // read with digitalRead()
+  if (port == _numPorts)
+    _portRegs[_numPorts++] = reg;
+  pin.port = port;
+  pin.portMask = (uint32_t)digitalPinToBitMask(pin.pinName);
+#endif
+}
+
+/**********************************************************/
+/*!
+    @brief    Reads a digital input from its port's register,
+              which is read once per pass and shared by
+              every input on the port.
+    @param    pin
+              The digital input pin.
+    @returns  The pin's value.
+*/
+/**********************************************************/
+int Wippersnapper_DigitalGPIO::readInput(const digitalInputPin &pin) {
+#ifdef WS_DIGITAL_PORT_READS
+  if (pin.port != WS_DIGITAL_NO_PORT) {
+    if (!(_portsRead & (1 << pin.port))) {
+      _portVals[pin.port] = *_portRegs[pin.port];
+      _portsRead |= 1 << pin.port;
+    }
+    return (_portVals[pin.port] & pin.portMask) ? HIGH : LOW;
+  }
+#endif
+  return digitalReadSvc(pin.pinName);
+}
+
+/**********************************************************/
+/*!
+    @brief    Checks if an on-change pin's level differs from
+              the last one published and has held for
+              WS_DIGITAL_DEBOUNCE_MS, shorter glitches and
+              contact bounce are ignored.
+    @param    pin
+              The digital input pin.
+    @param    curTimeUs
+              Current time, from micros().
+    @returns  True if the pin's new level should be published.
+*/
+/**********************************************************/
+bool Wippersnapper_DigitalGPIO::isSettled(const digitalInputPin &pin,
+                                          unsigned long curTimeUs) {
+  return pin.rawVal != pin.prvPinVal &&
+         curTimeUs - pin.rawSince >= WS_DIGITAL_DEBOUNCE_MS * 1000UL;
+}
+
+/**********************************************************/
+/*!
+    @brief    Checks if a pin is listed in
+              WS_DIGITAL_COUNTER_PINS.
+    @param    pinName
+              The pin's name.
+    @returns  True if the pin reports a pulse count.
+*/
+/**********************************************************/
+bool Wippersnapper_DigitalGPIO::isCounterPin(uint8_t pinName) {
+#ifdef WS_DIGITAL_COUNTER_PINS
+  static const uint8_t counterPins[] = {WS_DIGITAL_COUNTER_PINS};
+  for (size_t i = 0; i < sizeof(counterPins); i++) {
+    if (counterPins[i] == pinName)
+      return true;
+  }
+#endif
+  (void)pinName;
+  return false;
+}
+
+/**********************************************************/
+/*!
+    @brief    Returns and resets the pulses counted by an
+              interrupt slot.
+    @param    slot
+              Interrupt slot of a counter pin.
+    @returns  Rising edges since the previous call.
+*/
+/**********************************************************/
+uint32_t Wippersnapper_DigitalGPIO::takePulseCount(uint8_t slot) {
+  noInterrupts();
+  uint32_t count = _irqCounts[slot];
+  _irqCounts[slot] = 0;
+  interrupts();
+  return count;
+}
+
+/**********************************************************/
+/*!
+    @brief    Attaches an interrupt to a digital input, so
+              it is not polled every pass.
+    @param    pinIdx
+              Index of the pin in _digital_input_pins.
+    @param    count
+              True to count rising edges, False to capture
+              every level change.
+    @returns  True if an interrupt was attached, False if
+              the pin must be polled.
+*/
+/**********************************************************/
+bool Wippersnapper_DigitalGPIO::attachPinInterrupt(int pinIdx, bool count) {
+  digitalInputPin &pin = _digital_input_pins[pinIdx];
+#ifdef NOT_AN_INTERRUPT
+  if (digitalPinToInterrupt(pin.pinName) == NOT_AN_INTERRUPT)
+    return false;
+#endif
+  for (uint8_t slot = 0; slot < WS_DIGITAL_IRQ_PINS; slot++) {
+    if (_irqInputs[slot] != -1)
+      continue;
+
+    // Report the initial state as polling would, then only changes
+    if (!count) {
+      int pinVal = digitalReadSvc(pin.pinName);
+      if (pinVal != pin.prvPinVal)
+        queuePinEvent(pin.pinName, pinVal);
+      pin.prvPinVal = pinVal;
+      pin.rawVal = pinVal;
+    }
+
+    _irqInputs[slot] = pinIdx;
+    _irqPinNames[slot] = pin.pinName;
+    _irqCounting[slot] = count;
+    _irqCounts[slot] = 0;
+    pin.irqSlot = (int8_t)slot;
+    attachInterrupt(digitalPinToInterrupt(pin.pinName), _irqHandlers[slot],
+                    count ? RISING : CHANGE);
+    WS_DEBUG_PRINT(count ? "Counting pulses on D" : "Capturing edges of D");
+    WS_DEBUG_PRINT(pin.pinName);
+    WS_DEBUG_PRINTLN(" by interrupt");
+    return true;
+  }
+  WS_DEBUG_PRINTLN("WARNING: No free interrupt slot, polling pin instead");
+  return false;
+}
+
+/**********************************************************/
+/*!
+    @brief    Detaches a digital input's interrupt, if it
+              has one.
+    @param    pinIdx
+              Index of the pin in _digital_input_pins.
+*/
+/**********************************************************/
+void Wippersnapper_DigitalGPIO::detachPinInterrupt(int pinIdx) {
+  digitalInputPin &pin = _digital_input_pins[pinIdx];
+  if (pin.irqSlot < 0)
+    return;
+  detachInterrupt(digitalPinToInterrupt(pin.pinName));
+  _irqInputs[pin.irqSlot] = -1;
+  pin.irqSlot = -1;
+}
+
+/**********************************************************/
+/*!
+    @brief    Records a level change in the edge queue, or
+              counts a pulse, called from a pin's interrupt
+              handler.
+    @param    slot
+              Interrupt slot of the pin that changed.
+*/
+/**********************************************************/
+void IRAM_ATTR Wippersnapper_DigitalGPIO::captureEdge(uint8_t slot) {
+  if (_irqCounting[slot]) {
+    _irqCounts[slot]++;
+    return;
+  }
+  uint8_t tail = _edgeTail;
+  uint8_t next = (tail + 1) % WS_DIGITAL_EDGE_QUEUE_LEN;
+  if (next == _edgeHead) {
+    _edgesDropped++;
+    return;
+  }
+  _edges[tail].irqSlot = slot;
+  _edges[tail].pinVal = (uint8_t)digitalRead(_irqPinNames[slot]);
+  _edges[tail].timestamp = micros();
+  _edgeTail = next; // publish the edge to the loop last
+}
+
+/**********************************************************/
+/*!
+    @brief    Finds when processDigitalInputs() next has
+              work to do.
+    @param    curTime
+              Current time, from millis().
+    @returns  Deadline as a millis() timestamp, curTime if
+              a state-based pin must be polled or edges
+              are waiting to be published.
+*/
+/**********************************************************/
+unsigned long
+Wippersnapper_DigitalGPIO::getNextUpdateTime(unsigned long curTime) {
+  if (hasPendingEdges())
+    return curTime;
+  unsigned long nextTime = curTime + WS_SCHEDULER_IDLE_MS;
+  for (int i = 0; i < _totalDigitalInputPins; i++) {
+    if (_digital_input_pins[i].period == 0L &&
+        _digital_input_pins[i].irqSlot < 0)
+      return curTime; // polled on-change pins are read every pass
+    if (_digital_input_pins[i].period == 0L &&
+        _digital_input_pins[i].rawVal != _digital_input_pins[i].prvPinVal) {
+      // an interrupt-driven pin is waiting for its level to settle
+      unsigned long heldUs = micros() - _digital_input_pins[i].rawSince;
+      unsigned long settleUs = WS_DIGITAL_DEBOUNCE_MS * 1000UL;
+      nextTime = ws_scheduler::earliest(
+          nextTime,
+          curTime + (heldUs < settleUs ? (settleUs - heldUs) / 1000 + 1 : 0));
+    }
+    if (_digital_input_pins[i].period > 0L)
+      nextTime = ws_scheduler::earliest(
+          nextTime, (unsigned long)_digital_input_pins[i].prvPeriod +
+                        _digital_input_pins[i].period + 1);
+  }
+  return nextTime;
+}
@@ -18,12 +18,54 @@
 
 #include "Wippersnapper.h"
 
+#ifndef IRAM_ATTR
+#define IRAM_ATTR ///< Places interrupt handlers in RAM on cores that need it
+#endif
+
+#define WS_DIGITAL_IRQ_PINS                                                    \
+  8 ///< On-change inputs that can be captured by interrupt
+#define WS_DIGITAL_EDGE_QUEUE_LEN                                              \
+  32 ///< Edges buffered between processDigitalInputs() passes
+// On-change inputs publish a new level once it has held for
+// WS_DIGITAL_DEBOUNCE_MS, filtering contact bounce and glitches. Setting it
+// to 0 publishes every edge.
+#ifndef WS_DIGITAL_DEBOUNCE_MS
+#define WS_DIGITAL_DEBOUNCE_MS 20 ///< Settle time of on-change inputs, in ms
+#endif
+
+#if defined(portInputRegister) && defined(digitalPinToPort) &&                 \
+    defined(digitalPinToBitMask) && !defined(WS_DIGITAL_NO_PORT_READS)
+#define WS_DIGITAL_PORT_READS ///< Polled inputs are read a port at a time
+/** Pointer to a port's input register. Cores differ in how they identify
+    ports, an integer on AVR and ESP, a PortGroup* on SAMD, so the register
+    is kept rather than the port. */
+typedef decltype(portInputRegister(digitalPinToPort(0))) ws_port_reg_t;
+#endif
+#define WS_DIGITAL_MAX_PORTS 4  ///< GPIO ports read by port snapshots
+#define WS_DIGITAL_NO_PORT 0xFF ///< Pin is read with digitalRead() instead
+
+// Periodic inputs on the pins listed in WS_DIGITAL_COUNTER_PINS, such as
+// -DWS_DIGITAL_COUNTER_PINS=5,6, report the rising edges counted over each
+// period instead of the pin's level.
+
 /** Holds data about a digital input pin */
 struct digitalInputPin {
-  uint8_t pinName; ///< Pin name
-  long period;     ///< Timer interval, in millis, -1 if disabled.
-  long prvPeriod;  ///< When timer was previously serviced, in millis
-  int prvPinVal;   ///< Previous pin value
+  uint8_t pinName;        ///< Pin name
+  long period;            ///< Timer interval, in millis, -1 if disabled.
+  long prvPeriod;         ///< When timer was previously serviced, in millis
+  int prvPinVal;          ///< Previous pin value
+  int rawVal;             ///< Last value read, before debouncing
+  unsigned long rawSince; ///< When rawVal was last changed, in micros
+  int8_t irqSlot;         ///< Interrupt capturing the pin's edges, -1 if polled
+  uint8_t port;           ///< Index of the pin's port, or WS_DIGITAL_NO_PORT
+  uint32_t portMask;      ///< Pin's bit in its port's input register
+};
+
+/** Level change captured by a pin's interrupt handler */
+struct digitalInputEdge {
+  uint8_t irqSlot;         ///< Interrupt slot of the pin that changed
+  uint8_t pinVal;          ///< Pin value read in the interrupt handler
+  unsigned long timestamp; ///< micros() when the edge was captured
 };
 
 // forward decl.
@@ -51,11 +93,60 @@ public:
   int digitalReadSvc(int pinName);
   void digitalWriteSvc(uint8_t pinName, int pinValue);
   void processDigitalInputs();
+  unsigned long getNextUpdateTime(unsigned long curTime);
+  /**************************************************************************/
+  /*!
+      @brief    Checks if interrupts captured edges that have not been
+                published yet.
+      @returns  True if processDigitalInputs() has edges to drain.
+  */
+  /**************************************************************************/
+  bool hasPendingEdges() { return _edgeHead != _edgeTail; }
 
   digitalInputPin *_digital_input_pins; /*!< Array of gpio pin objects */
 private:
+  bool queuePinEvent(uint8_t pinName, int pinVal);
+  void mapPinToPort(digitalInputPin &pin);
+  int readInput(const digitalInputPin &pin);
+  bool isSettled(const digitalInputPin &pin, unsigned long curTimeUs);
+  bool isCounterPin(uint8_t pinName);
+  uint32_t takePulseCount(uint8_t slot);
+  bool attachPinInterrupt(int pinIdx, bool count);
+  void detachPinInterrupt(int pinIdx);
+  void processEdges();
+  static void captureEdge(uint8_t slot);
+  /**************************************************************************/
+  /*!
+      @brief    Interrupt handler for one slot, attachInterrupt() does not
+                pass the handler which pin changed.
+  */
+  /**************************************************************************/
+  template <uint8_t slot> static void IRAM_ATTR isrEdge() {
+    captureEdge(slot);
+  }
+
   int32_t
       _totalDigitalInputPins; /*!< Total number of digital-input capable pins */
+  int _irqInputs[WS_DIGITAL_IRQ_PINS]; /*!< Input index per slot, -1 if free */
+  ws_pin_event_batch _pinEvents; /*!< Events queued by processDigitalInputs */
+#ifdef WS_DIGITAL_PORT_READS
+  ws_port_reg_t _portRegs[WS_DIGITAL_MAX_PORTS]; /*!< Ports with input pins */
+#endif
+  uint32_t _portVals[WS_DIGITAL_MAX_PORTS]; /*!< Input registers this pass */
+  uint8_t _numPorts = 0;                    /*!< Ports in _portRegs */
+  uint8_t _portsRead = 0; /*!< Bit per port already read this pass */
+  static void (*const _irqHandlers[WS_DIGITAL_IRQ_PINS])(); /*!< Per slot */
+  static volatile uint8_t
+      _irqPinNames[WS_DIGITAL_IRQ_PINS]; /*!< Pin read by each slot */
+  static volatile bool
+      _irqCounting[WS_DIGITAL_IRQ_PINS]; /*!< Slot counts rising edges */
+  static volatile uint32_t
+      _irqCounts[WS_DIGITAL_IRQ_PINS]; /*!< Pulses counted by each slot */
+  static volatile digitalInputEdge
+      _edges[WS_DIGITAL_EDGE_QUEUE_LEN];  /*!< Edges, written by the ISRs */
+  static volatile uint8_t _edgeHead;      /*!< Oldest edge, owned by loop */
+  static volatile uint8_t _edgeTail;      /*!< Next free edge, owned by ISRs */
+  static volatile uint16_t _edgesDropped; /*!< Edges lost, queue was full */
 };
 extern Wippersnapper WS;
 
@@ -33,6 +33,7 @@ ws_ds18x20::~ws_ds18x20() {
   for (size_t idx = 0; idx < _ds18xDrivers.size(); idx++) {
     delete _ds18xDrivers[idx]->dallasTempObj;
     delete _ds18xDrivers[idx]->oneWire;
+    delete _ds18xDrivers[idx];
   }
   // remove all elements
   _ds18xDrivers.clear();
@@ -40,9 +41,13 @@ ws_ds18x20::~ws_ds18x20() {
 
 /********************************************************************/
 /*!
-    @brief    Initializes a DS18x20 sensor using a
-              configuration sent by the broker and adds it to a
-              vector of ds18x20 sensor drivers.
+    @brief    Initializes the DS18x20 sensors on a OneWire bus
+              using a configuration sent by the broker and adds
+              the bus to a vector of ds18x20 sensor drivers.
+              Every sensor found on the bus shares its OneWire
+              and DallasTemperature instances. Only the first
+              sensor is used unless the broker tells sensors
+              apart by their address.
     @param    msgDs18x20InitReq
               Message containing configuration data for a
               ds18x20 sensor.
@@ -53,16 +58,41 @@ bool ws_ds18x20::addDS18x20(
     wippersnapper_ds18x20_v1_Ds18x20InitRequest *msgDs18x20InitReq) {
   bool is_success = false;
 
+  // a pin has one bus, release it if the broker configures the pin again
+  removeBus(msgDs18x20InitReq->onewire_pin);
+
   // init. new ds18x20 object
   ds18x20Obj *newObj = new ds18x20Obj();
   char *oneWirePin = msgDs18x20InitReq->onewire_pin + 1;
   newObj->oneWire = new OneWire(atoi(oneWirePin));
   newObj->dallasTempObj = new DallasTemperature(newObj->oneWire);
   newObj->dallasTempObj->begin();
-  // attempt to obtain sensor address
-  if (newObj->dallasTempObj->getAddress(newObj->dallasTempAddr, 0)) {
-    // attempt to set sensor resolution
+  // enumerate the ROM of every DS sensor on the bus, in one search
+  ds18x20Sensor sensor;
+  newObj->oneWire->reset_search();
+  while (newObj->oneWire->search(sensor.address)) {
+    if (!newObj->dallasTempObj->validAddress(sensor.address) ||
+        !newObj->dallasTempObj->validFamily(sensor.address))
+      continue;
+    static const char hexDigits[] = "0123456789ABCDEF";
+    for (int i = 0; i < 8; i++) {
+      sensor.addressHex[i * 2] = hexDigits[sensor.address[i] >> 4];
+      sensor.addressHex[i * 2 + 1] = hexDigits[sensor.address[i] & 0x0F];
+    }
+    sensor.addressHex[16] = '\0';
+    newObj->sensors.push_back(sensor);
+    // a broker without per-sensor events would merge the sensors' readings
+    if (!WS._ds18x20SensorAddresses)
+      break;
+  }
+  if (!newObj->sensors.empty()) {
+    // attempt to set the resolution of every sensor on the bus
     newObj->dallasTempObj->setResolution(msgDs18x20InitReq->sensor_resolution);
+    // start conversions without waiting, update() collects them later
+    newObj->dallasTempObj->setWaitForConversion(false);
+    newObj->conversionTime =
+        newObj->dallasTempObj->millisToWaitForConversion(
+            newObj->dallasTempObj->getResolution());
     // copy the device's sensor properties
     newObj->sensorPropertiesCount =
         msgDs18x20InitReq->i2c_device_properties_count;
@@ -81,6 +111,9 @@ bool ws_ds18x20::addDS18x20(
     is_success = true;
   } else {
     WS_DEBUG_PRINTLN("Failed to find DSx sensor on specified pin.");
+    delete newObj->dallasTempObj;
+    delete newObj->oneWire;
+    delete newObj;
   }
 
   // fill and publish the initialization response back to the broker
@@ -92,6 +125,8 @@ bool ws_ds18x20::addDS18x20(
   msgInitResp.payload.resp_ds18x20_init.is_initialized = is_success;
   strcpy(msgInitResp.payload.resp_ds18x20_init.onewire_pin,
          msgDs18x20InitReq->onewire_pin);
+  if (is_success && WS._ds18x20SensorAddresses)
+    msgInitResp.payload.resp_ds18x20_init.sensor_count = newObj->sensors.size();
 
   WS_DEBUG_PRINT("Created OneWireBus on GPIO ");
   WS_DEBUG_PRINT(msgDs18x20InitReq->onewire_pin);
@@ -105,49 +140,58 @@ bool ws_ds18x20::addDS18x20(
 #endif
 
   // Encode and publish response back to broker
-  memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-  pb_ostream_t ostream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_Ds18x20Response_fields,
-                    &msgInitResp)) {
+  msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_Ds18x20Response_fields, &msgInitResp);
+  if (msgSz == 0) {
     WS_DEBUG_PRINTLN("ERROR: Unable to encode msg_init response message!");
     return false;
   }
-  pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_Ds18x20Response_fields,
-                      &msgInitResp);
   WS_DEBUG_PRINT("-> DS18x Init Response...");
-  WS._mqtt->publish(WS._topic_signal_ds18_device, WS._buffer_outgoing, msgSz,
-                    1);
-  WS_DEBUG_PRINTLN("Published!");
+  WS._publishQueue->enqueue(WS._topic_signal_ds18_device, WS._buffer_outgoing,
+                            msgSz, 1);
+  WS_DEBUG_PRINTLN("Queued!");
 
   return is_success;
 }
 
 /********************************************************************/
 /*!
-    @brief    De-initializes a DS18x20 sensor and releases its
-              pin and resources.
-    @param    msgDS18x20DeinitReq
-              Message containing configuration data for a
-              ds18x20 sensor.
+    @brief    Releases the OneWire bus on a pin, if there is one.
+    @param    onewire_pin
+              Pin utilized by the OneWire bus.
 */
 /********************************************************************/
-void ws_ds18x20::deleteDS18x20(
-    wippersnapper_ds18x20_v1_Ds18x20DeInitRequest *msgDS18x20DeinitReq) {
+void ws_ds18x20::removeBus(const char *onewire_pin) {
   // Loop thru vector of drivers to find the unique address
   for (size_t idx = 0; idx < _ds18xDrivers.size(); idx++) {
-    if (strcmp(_ds18xDrivers[idx]->onewire_pin,
-               msgDS18x20DeinitReq->onewire_pin) == 0) {
+    if (strcmp(_ds18xDrivers[idx]->onewire_pin, onewire_pin) == 0) {
       WS_DEBUG_PRINT("Deleting OneWire instance on pin ");
-      WS_DEBUG_PRINTLN(msgDS18x20DeinitReq->onewire_pin);
+      WS_DEBUG_PRINTLN(onewire_pin);
       delete _ds18xDrivers[idx]
           ->dallasTempObj; // delete dallas temp instance on pin
       delete _ds18xDrivers[idx]
           ->oneWire; // delete OneWire instance on pin and release pin for reuse
+      delete _ds18xDrivers[idx];
       _ds18xDrivers.erase(_ds18xDrivers.begin() +
                           idx); // erase vector and re-allocate
+      return;
     }
   }
+}
+
+/********************************************************************/
+/*!
+    @brief    De-initializes the DS18x20 sensors on a OneWire bus
+              and releases its pin and resources.
+    @param    msgDS18x20DeinitReq
+              Message containing configuration data for a
+              ds18x20 sensor.
+*/
+/********************************************************************/
+void ws_ds18x20::deleteDS18x20(
+    wippersnapper_ds18x20_v1_Ds18x20DeInitRequest *msgDS18x20DeinitReq) {
+  removeBus(msgDS18x20DeinitReq->onewire_pin);
 
 #ifdef USE_DISPLAY
   char buffer[100];
@@ -159,155 +203,191 @@ void ws_ds18x20::deleteDS18x20(
 
 /*************************************************************/
 /*!
-    @brief    Iterates through each ds18x20 sensor and
-              reports data (if period expired) to Adafruit IO.
+    @brief    Checks if any of a bus's sensor periods have elapsed.
+    @param    driver
+              OneWire bus.
+    @param    curTime
+              Current time, from millis().
+    @returns  True if the bus's sensors should be read.
 */
 /*************************************************************/
-void ws_ds18x20::update() {
-  // return immediately if no drivers have been initialized
-  if (_ds18xDrivers.size() == 0)
-    return;
+bool ws_ds18x20::isSensorDue(ds18x20Obj *driver, long curTime) {
+  for (int i = 0; i < driver->sensorPropertiesCount; i++) {
+    if (curTime - driver->sensorPeriodPrv >
+        (long)driver->sensorProperties[i].sensor_period)
+      return true;
+  }
+  return false;
+}
 
-  long curTime; // used for holding the millis() value
-  std::vector<ds18x20Obj *>::iterator iter, end;
-  for (iter = _ds18xDrivers.begin(), end = _ds18xDrivers.end(); iter != end;
-       ++iter) {
+/*************************************************************/
+/*!
+    @brief    Queues a sensor's reading for each of its bus's
+              sensor types.
+    @param    driver
+              OneWire bus the sensor is on.
+    @param    sensor
+              DS18x20 sensor.
+    @param    tempC
+              Temperature read from the sensor, in Celsius.
+*/
+/*************************************************************/
+void ws_ds18x20::publishSensorEvent(ds18x20Obj *driver, ds18x20Sensor &sensor,
+                                    float tempC) {
+  // Create an empty DS18x20 event signal message and configure
+  wippersnapper_signal_v1_Ds18x20Response msgDS18x20Response =
+      wippersnapper_signal_v1_Ds18x20Response_init_zero;
+  msgDS18x20Response.which_payload =
+      wippersnapper_signal_v1_Ds18x20Response_resp_ds18x20_event_tag;
+  wippersnapper_ds18x20_v1_Ds18x20DeviceEvent *event =
+      &msgDS18x20Response.payload.resp_ds18x20_event;
 
-    // Create an empty DS18x20 event signal message and configure
-    wippersnapper_signal_v1_Ds18x20Response msgDS18x20Response =
-        wippersnapper_signal_v1_Ds18x20Response_init_zero;
-    msgDS18x20Response.which_payload =
-        wippersnapper_signal_v1_Ds18x20Response_resp_ds18x20_event_tag;
+  // check and pack based on sensorType
+  for (int i = 0; i < driver->sensorPropertiesCount; i++) {
+    wippersnapper_i2c_v1_SensorType type =
+        driver->sensorProperties[i].sensor_type;
+    float value;
+    char unit;
+    if (type ==
+        wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE) {
+      value = tempC;
+      unit = 'C';
+    } else if (
+        type ==
+        wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT) {
+      value = driver->dallasTempObj->toFahrenheit(tempC);
+      unit = 'F';
+    } else {
+      continue;
+    }
+    event->sensor_event[event->sensor_event_count].type = type;
+    event->sensor_event[event->sensor_event_count].value = value;
+    event->sensor_event_count++;
 
-    // take the current time for the driver (*iter)
-    curTime = millis();
-    // Poll each sensor type, if period has elapsed
-    for (int i = 0; i < (*iter)->sensorPropertiesCount; i++) {
-      // has sensor_period elapsed?
-      if (curTime - (*iter)->sensorPeriodPrv >
-          (long)(*iter)->sensorProperties[i].sensor_period) {
-        // issue global temperature request to all DS sensors
-        WS_DEBUG_PRINTLN("Requesting temperature..");
-        (*iter)->dallasTempObj->requestTemperatures();
-        // poll the DS sensor driver
-        float tempC = (*iter)->dallasTempObj->getTempC((*iter)->dallasTempAddr);
-        if (tempC == DEVICE_DISCONNECTED_C) {
-          WS_DEBUG_PRINTLN("ERROR: Could not read temperature data, is the "
-                           "sensor disconnected?");
+    WS_DEBUG_PRINT("(OneWireBus GPIO: ");
+    WS_DEBUG_PRINT(driver->onewire_pin);
+    WS_DEBUG_PRINT(", ROM: ");
+    WS_DEBUG_PRINT(sensor.addressHex);
+    WS_DEBUG_PRINT(") DS18x20 Value: ");
+    WS_DEBUG_PRINT(value);
+    WS_DEBUG_PRINT("*");
+    WS_DEBUG_PRINTLN(unit);
 #ifdef USE_DISPLAY
-          WS._ui_helper->add_text_to_terminal(
-              "[DS18x ERROR] Unable to read temperature, is the sensor "
-              "disconnected?\n");
+    char buffer[100];
+    snprintf(buffer, 100, "[DS18x] Read %0.2f*%c on GPIO %s\n", value,
+             unit, driver->onewire_pin);
+    WS._ui_helper->add_text_to_terminal(buffer);
 #endif
-          break;
-        }
-
-        // check and pack based on sensorType
-        char buffer[100];
-        if ((*iter)->sensorProperties[i].sensor_type ==
-            wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE) {
-
-          WS_DEBUG_PRINT("(OneWireBus GPIO: ");
-          WS_DEBUG_PRINT((*iter)->onewire_pin);
-          WS_DEBUG_PRINT(") DS18x20 Value: ");
-          WS_DEBUG_PRINT(tempC);
-          WS_DEBUG_PRINTLN("*C")
-          snprintf(buffer, 100, "[DS18x] Read %0.2f*C on GPIO %s\n", tempC,
-                   (*iter)->onewire_pin);
-
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i].type =
-              wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE;
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i].value =
-              tempC;
-
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event_count++;
-        }
-
-        if ((*iter)->sensorProperties[i].sensor_type ==
-            wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT) {
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i].type =
-              wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT;
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i].value =
-              (*iter)->dallasTempObj->toFahrenheit(tempC);
-          WS_DEBUG_PRINT("(OneWireBus GPIO: ");
-          WS_DEBUG_PRINT((*iter)->onewire_pin);
-          WS_DEBUG_PRINT(") DS18x20 Value: ");
-          WS_DEBUG_PRINT(
-              msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i]
-                  .value);
-          WS_DEBUG_PRINTLN("*F")
-          snprintf(buffer, 100, "[DS18x] Read %0.2f*F on GPIO %s\n",
-                   msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i]
-                       .value,
-                   (*iter)->onewire_pin);
-
-          msgDS18x20Response.payload.resp_ds18x20_event.sensor_event_count++;
-        }
+  }
+  if (event->sensor_event_count == 0)
+    return;
 
-        // did we obtain the expected amount of sensor events for the
-        // `resp_ds18x20_event` message?
-        if (msgDS18x20Response.payload.resp_ds18x20_event.sensor_event_count ==
-            (*iter)->sensorPropertiesCount) {
+  // prep sensor event data for sending to IO
+  // use onewire_pin, and the sensor's ROM if the broker accepts it, as the
+  // "address"
+  strcpy(event->onewire_pin, driver->onewire_pin);
+  const char *key = driver->onewire_pin;
+  if (WS._ds18x20SensorAddresses) {
+    strcpy(event->sensor_address, sensor.addressHex);
+    key = sensor.addressHex;
+  }
+  // prep and encode buffer
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_Ds18x20Response_fields, &msgDS18x20Response);
+  if (msgSz == 0) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to encode DS18x20 event responsemessage!");
+    return;
+  }
 
-          // prep sensor event data for sending to IO
-          // use onewire_pin as the "address"
-          strcpy(msgDS18x20Response.payload.resp_ds18x20_event.onewire_pin,
-                 (*iter)->onewire_pin);
-          // prep and encode buffer
-          memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-          pb_ostream_t ostream = pb_ostream_from_buffer(
-              WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-          if (!ws_pb_encode(&ostream,
-                            wippersnapper_signal_v1_Ds18x20Response_fields,
-                            &msgDS18x20Response)) {
-            WS_DEBUG_PRINTLN(
-                "ERROR: Unable to encode DS18x20 event responsemessage!");
-            snprintf(buffer, 100,
-                     "[DS18x ERROR] Unable to encode event message!");
-            return;
-          }
+  // Publish I2CResponse msg
+  WS_DEBUG_PRINT("QUEUEING -> msgDS18x20Response Event Message...");
+  if (!WS._publishQueue->enqueue(WS._topic_signal_ds18_device,
+                                 WS._buffer_outgoing, msgSz, 1,
+                                 ws_publish_queue::keyFor(key))) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to queue DS18x20 event message!");
+    return;
+  }
+  WS_DEBUG_PRINTLN("QUEUED!");
+}
 
-          WS_DEBUG_PRINTLN(
-              "DEBUG: msgDS18x20Response sensor_event message contents:");
-          for (int i = 0;
-               i <
-               msgDS18x20Response.payload.resp_ds18x20_event.sensor_event_count;
-               i++) {
-            WS_DEBUG_PRINT("sensor_event[#]: ");
-            WS_DEBUG_PRINTLN(i);
-            WS_DEBUG_PRINT("\tOneWire Bus: ");
-            WS_DEBUG_PRINTLN(
-                msgDS18x20Response.payload.resp_ds18x20_event.onewire_pin);
-            WS_DEBUG_PRINT("\tsensor_event type: ");
-            WS_DEBUG_PRINTLN(
-                msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i]
-                    .type);
-            WS_DEBUG_PRINT("\tsensor_event value: ");
-            WS_DEBUG_PRINTLN(
-                msgDS18x20Response.payload.resp_ds18x20_event.sensor_event[i]
-                    .value);
-          }
+/*************************************************************/
+/*!
+    @brief    Iterates through each OneWire bus and reports
+              data (if period expired) to Adafruit IO.
+              A due bus is sent one conversion request, which
+              every sensor on it acts on, and update() returns.
+              Once the conversion time for the bus's resolution
+              has passed, later calls read the sensors one per
+              call so a long string of sensors never holds up
+              the loop.
+*/
+/*************************************************************/
+void ws_ds18x20::update() {
+  // return immediately if no drivers have been initialized
+  if (_ds18xDrivers.size() == 0)
+    return;
 
-          // Publish I2CResponse msg
-          size_t msgSz;
-          pb_get_encoded_size(&msgSz,
-                              wippersnapper_signal_v1_Ds18x20Response_fields,
-                              &msgDS18x20Response);
-          WS_DEBUG_PRINT("PUBLISHING -> msgDS18x20Response Event Message...");
-          if (!WS._mqtt->publish(WS._topic_signal_ds18_device,
-                                 WS._buffer_outgoing, msgSz, 1)) {
-            WS_DEBUG_PRINTLN("ERROR: Unable to publish DS18x20 event message - "
-                             "MQTT Publish failed!");
-            return;
-          };
-          WS_DEBUG_PRINTLN("PUBLISHED!");
+  long curTime = millis();
+  for (ds18x20Obj *driver : _ds18xDrivers) {
+    if (driver->converting) {
+      // has the conversion finished?
+      if ((unsigned long)curTime - driver->conversionStart <
+          driver->conversionTime)
+        continue;
+      ds18x20Sensor &sensor = driver->sensors[driver->nextSensor++];
+      if (driver->nextSensor == driver->sensors.size()) {
+        driver->converting = false;
+        driver->sensorPeriodPrv = driver->conversionStart; // set prv period
+      }
+      float tempC = driver->dallasTempObj->getTempC(sensor.address);
+      if (tempC == DEVICE_DISCONNECTED_C) {
+        WS_DEBUG_PRINT("ERROR: Could not read temperature data from ");
+        WS_DEBUG_PRINT(sensor.addressHex);
+        WS_DEBUG_PRINTLN(", is the sensor disconnected?");
 #ifdef USE_DISPLAY
-          WS._ui_helper->add_text_to_terminal(buffer);
+        WS._ui_helper->add_text_to_terminal(
+            "[DS18x ERROR] Unable to read temperature, is the sensor "
+            "disconnected?\n");
 #endif
-
-          (*iter)->sensorPeriodPrv = curTime; // set prv period
-        }
+        continue;
       }
+      publishSensorEvent(driver, sensor, tempC);
+    } else if (isSensorDue(driver, curTime)) {
+      // issue a conversion to every DS sensor on the bus, without waiting
+      WS_DEBUG_PRINTLN("Requesting temperature..");
+      driver->dallasTempObj->requestTemperatures();
+      driver->conversionStart = curTime;
+      driver->nextSensor = 0;
+      driver->converting = true;
+    }
+  }
+}
+
+/*************************************************************/
+/*!
+    @brief    Finds when update() next has a sensor to read.
+    @param    curTime
+              Current time, from millis().
+    @returns  Deadline as a millis() timestamp.
+*/
+/*************************************************************/
+unsigned long ws_ds18x20::getNextUpdateTime(unsigned long curTime) {
+  unsigned long nextTime = curTime + WS_SCHEDULER_IDLE_MS;
+  for (ds18x20Obj *driver : _ds18xDrivers) {
+    if (driver->converting) {
+      // once the conversion is done, the sensors are read one per pass
+      unsigned long readTime = driver->conversionStart + driver->conversionTime;
+      if ((long)(readTime - curTime) <= 0)
+        readTime = curTime + 1;
+      nextTime = ws_scheduler::earliest(nextTime, readTime);
+      continue;
+    }
+    for (int i = 0; i < driver->sensorPropertiesCount; i++) {
+      nextTime = ws_scheduler::earliest(
+          nextTime, (unsigned long)driver->sensorPeriodPrv +
+                        (long)driver->sensorProperties[i].sensor_period + 1);
     }
   }
-}
\ No newline at end of file
+  return nextTime;
+}
@@ -21,19 +21,30 @@
 #include <Adafruit_Sensor.h>
 #include <DallasTemperature.h>
 
-/** DS18x20 Object */
+/** DS18x20 sensor found on a OneWire bus */
+struct ds18x20Sensor {
+  DeviceAddress address; ///< Sensor's 64-bit ROM code
+  char addressHex[17];   ///< ROM code as hex, reported with the sensor's events
+};
+
+/** DS18x20 Object, the OneWire bus and every sensor found on its pin */
 struct ds18x20Obj {
   OneWire *
       oneWire; ///< Pointer to an OneWire bus used by a DallasTemperature object
   char onewire_pin[5]; ///< Pin utilized by the OneWire bus, used for addressing
   DallasTemperature
       *dallasTempObj; ///< Pointer to a DallasTemperature sensor object
-  DeviceAddress dallasTempAddr; ///< Temperature sensor's address
-  int sensorPropertiesCount;    ///< Tracks # of sensorProperties
+  std::vector<ds18x20Sensor> sensors; ///< Sensors on the bus, in search order
+  int sensorPropertiesCount;          ///< Tracks # of sensorProperties
   wippersnapper_i2c_v1_I2CDeviceSensorProperties sensorProperties[2] =
       wippersnapper_i2c_v1_I2CDeviceSensorProperties_init_zero; ///< DS sensor
                                                                 ///< type(s)
   long sensorPeriodPrv; ///< Last time the sensor was polled, in millis
+  bool converting;      ///< True while a temperature conversion is running
+  size_t nextSensor;    ///< Next sensor to read from the conversion
+  unsigned long conversionStart; ///< millis() when the conversion started
+  unsigned long conversionTime;  ///< Conversion time at the sensor's
+                                 ///< resolution, in millis
 };
 
 // forward decl.
@@ -55,8 +66,14 @@ public:
   void deleteDS18x20(
       wippersnapper_ds18x20_v1_Ds18x20DeInitRequest *msgDS18x20DeinitReq);
   void update();
+  unsigned long getNextUpdateTime(unsigned long curTime);
 
 private:
+  bool isSensorDue(ds18x20Obj *driver, long curTime);
+  void publishSensorEvent(ds18x20Obj *driver, ds18x20Sensor &sensor,
+                          float tempC);
+  void removeBus(const char *onewire_pin);
+
   std::vector<ds18x20Obj *>
       _ds18xDrivers; ///< Vec. of ptrs. to ds18x driver objects
 };
@@ -92,6 +92,11 @@ WipperSnapper_Component_I2C::WipperSnapper_Component_I2C(
     _i2c = &WIRE;
     _i2c->begin();
     _isInit = true;
+#elif defined(WS_NATIVE)
+    // Simulated bus, see native/hal/Wire.h
+    _i2c = (msgInitRequest->i2c_port_number == 0) ? &Wire : &Wire1;
+    _i2c->begin();
+    _isInit = true;
 #else
     // SAMD
     _i2c = new TwoWire(&PERIPH_WIRE, msgInitRequest->i2c_pin_sda,
@@ -868,27 +873,25 @@ bool WipperSnapper_Component_I2C::encodePublishI2CDeviceEventMsg(
     uint32_t sensorAddress) {
   // Encode I2CResponse msg
   msgi2cResponse->payload.resp_i2c_device_event.sensor_address = sensorAddress;
-  memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-  pb_ostream_t ostream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_I2CResponse_fields,
-                    msgi2cResponse)) {
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_I2CResponse_fields, msgi2cResponse);
+  if (msgSz == 0) {
     WS_DEBUG_PRINTLN(
         "ERROR: Unable to encode I2C device event response message!");
     return false;
   }
 
   // Publish I2CResponse msg
-  size_t msgSz;
-  pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_I2CResponse_fields,
-                      msgi2cResponse);
-  WS_DEBUG_PRINT("PUBLISHING -> I2C Device Sensor Event Message...");
-  if (!WS._mqtt->publish(WS._topic_signal_i2c_device, WS._buffer_outgoing,
-                         msgSz, 1)) {
-    WS_DEBUG_PRINTLN("ERROR: MQTT Publish failed!");
+  // Queue for publishing, replacing any unsent event from this device
+  WS_DEBUG_PRINT("QUEUEING -> I2C Device Sensor Event Message...");
+  uint32_t key = (((uint32_t)_portNum << 16) | sensorAddress) + 1;
+  if (!WS._publishQueue->enqueue(WS._topic_signal_i2c_device,
+                                 WS._buffer_outgoing, msgSz, 1, key)) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to queue I2C device event!");
     return false;
   };
-  WS_DEBUG_PRINTLN("PUBLISHED!");
+  WS_DEBUG_PRINTLN("QUEUED!");
   return true;
 }
 
@@ -1018,6 +1021,78 @@ void WipperSnapper_Component_I2C::displayDeviceEventMessage(
   }
 }
 
+/** Describes how a sensor type is logged and read from a sensors_event_t */
+struct i2cSensorTypeInfo {
+  wippersnapper_i2c_v1_SensorType sensorType; ///< Type of sensor reading
+  const char *name;                           ///< Name, for logging
+  const char *unit;                           ///< Unit suffix, for logging
+  float sensors_event_t::*valueMember; ///< Value member, nullptr for data[0]
+};
+
+/** Sensor types an I2C driver may report */
+static const i2cSensorTypeInfo i2cSensorTypes[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE,
+     "Ambient Temperature", " degrees C", &sensors_event_t::temperature},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT,
+     "Ambient Temperature", " degrees F", &sensors_event_t::temperature},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE,
+     "Object Temperature", " degrees C", &sensors_event_t::temperature},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE_FAHRENHEIT,
+     "Object Temperature", " degrees F", &sensors_event_t::temperature},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RELATIVE_HUMIDITY, "Humidity",
+     " %RH", &sensors_event_t::relative_humidity},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PRESSURE, "Pressure", " hPa",
+     &sensors_event_t::pressure},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2, "CO2", " ppm",
+     &sensors_event_t::CO2},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ECO2, "eCO2", " ppm",
+     &sensors_event_t::eCO2},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_TVOC, "TVOC", " ppb",
+     &sensors_event_t::tvoc},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ALTITUDE, "Altitude", " m",
+     &sensors_event_t::altitude},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_LIGHT, "Light", " lux",
+     &sensors_event_t::light},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_STD, "PM1.0", " ppm",
+     &sensors_event_t::pm10_std},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_STD, "PM2.5", " ppm",
+     &sensors_event_t::pm25_std},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_STD, "PM10.0", " ppm",
+     &sensors_event_t::pm100_std},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOLTAGE, "Voltage", " V",
+     &sensors_event_t::voltage},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CURRENT, "Current", " mA",
+     &sensors_event_t::current},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_UNITLESS_PERCENT,
+     "Unitless Percent", " %", &sensors_event_t::unitless_percent},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RAW, "Raw", "", nullptr},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_GAS_RESISTANCE,
+     "Gas Resistance", " Ohms", &sensors_event_t::gas_resistance},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_NOX_INDEX, "NOx Index", "",
+     &sensors_event_t::nox_index},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOC_INDEX, "VOC Index", "",
+     &sensors_event_t::voc_index},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY, "Proximity", "",
+     nullptr},
+};
+
+/*******************************************************************************/
+/*!
+    @brief    Looks up how a sensor type is logged and read.
+    @param    sensorType
+              The type of sensor reading.
+    @returns  Pointer to the sensor type's info, nullptr if unknown.
+*/
+/*******************************************************************************/
+static const i2cSensorTypeInfo *
+getSensorTypeInfo(wippersnapper_i2c_v1_SensorType sensorType) {
+  for (const i2cSensorTypeInfo &info : i2cSensorTypes) {
+    if (info.sensorType == sensorType)
+      return &info;
+  }
+  return nullptr;
+}
+
 /*******************************************************************************/
 /*!
     @brief    Queries all I2C device drivers for new values. Fills and sends an
@@ -1032,9 +1107,10 @@ void WipperSnapper_Component_I2C::update() {
   msgi2cResponse.which_payload =
       wippersnapper_signal_v1_I2CResponse_resp_i2c_device_event_tag;
 
-  long curTime;
   bool sensorsReturningFalse = true;
   int retries = 3;
+  // Lowered by sensorEventRead() to the earliest sensor deadline
+  _nextUpdateTime = millis() + WS_SCHEDULER_IDLE_MS;
 
   while (sensorsReturningFalse && retries > 0) {
     sensorsReturningFalse = false;
@@ -1045,234 +1121,18 @@ void WipperSnapper_Component_I2C::update() {
       // Number of events which occured for this driver
       msgi2cResponse.payload.resp_i2c_device_event.sensor_event_count = 0;
 
-      // Event struct
-      sensors_event_t event;
-
-      // AMBIENT_TEMPERATURE sensor (°C)
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventAmbientTemp,
-          &WipperSnapper_I2C_Driver::getSensorAmbientTempPeriod,
-          &WipperSnapper_I2C_Driver::getSensorAmbientTempPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorAmbientTempPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE,
-          "Ambient Temperature", " degrees C", event,
-          &sensors_event_t::temperature, sensorsReturningFalse, retries);
-
-      // Ambient Temperature sensor (°F)
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventAmbientTempF,
-          &WipperSnapper_I2C_Driver::getSensorAmbientTempFPeriod,
-          &WipperSnapper_I2C_Driver::getSensorAmbientTempFPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorAmbientTempFPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT,
-          "Ambient Temperature", " degrees F", event,
-          &sensors_event_t::temperature, sensorsReturningFalse, retries);
-
-      // OBJECT_TEMPERATURE sensor (°C)
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventObjectTemp,
-          &WipperSnapper_I2C_Driver::getSensorObjectTempPeriod,
-          &WipperSnapper_I2C_Driver::getSensorObjectTempPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorObjectTempPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE,
-          "Object Temperature", " degrees C", event,
-          &sensors_event_t::temperature, sensorsReturningFalse, retries);
-
-      // OBJECT_TEMPERATURE sensor (°F)
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventObjectTempF,
-          &WipperSnapper_I2C_Driver::getSensorObjectTempFPeriod,
-          &WipperSnapper_I2C_Driver::getSensorObjectTempFPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorObjectTempFPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE_FAHRENHEIT,
-          "Object Temperature", " degrees F", event,
-          &sensors_event_t::temperature, sensorsReturningFalse, retries);
-
-      // RELATIVE_HUMIDITY sensor
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventRelativeHumidity,
-          &WipperSnapper_I2C_Driver::getSensorRelativeHumidityPeriod,
-          &WipperSnapper_I2C_Driver::getSensorRelativeHumidityPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorRelativeHumidityPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RELATIVE_HUMIDITY,
-          "Humidity", " %RH", event, &sensors_event_t::relative_humidity,
-          sensorsReturningFalse, retries);
-
-      // PRESSURE sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventPressure,
-                      &WipperSnapper_I2C_Driver::getSensorPressurePeriod,
-                      &WipperSnapper_I2C_Driver::getSensorPressurePeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorPressurePeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PRESSURE,
-                      "Pressure", " hPa", event, &sensors_event_t::pressure,
-                      sensorsReturningFalse, retries);
-
-      // CO2 sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventCO2,
-                      &WipperSnapper_I2C_Driver::getSensorCO2Period,
-                      &WipperSnapper_I2C_Driver::getSensorCO2PeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorCO2PeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2, "CO2",
-                      " ppm", event, &sensors_event_t::CO2,
-                      sensorsReturningFalse, retries);
-
-      // eCO2 sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventECO2,
-                      &WipperSnapper_I2C_Driver::getSensorECO2Period,
-                      &WipperSnapper_I2C_Driver::getSensorECO2PeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorECO2PeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ECO2, "eCO2",
-                      " ppm", event, &sensors_event_t::eCO2,
-                      sensorsReturningFalse, retries);
-
-      // TVOC sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventTVOC,
-                      &WipperSnapper_I2C_Driver::getSensorTVOCPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorTVOCPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorTVOCPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_TVOC, "TVOC",
-                      " ppb", event, &sensors_event_t::tvoc,
-                      sensorsReturningFalse, retries);
-
-      // Altitude sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventAltitude,
-                      &WipperSnapper_I2C_Driver::getSensorAltitudePeriod,
-                      &WipperSnapper_I2C_Driver::getSensorAltitudePeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorAltitudePeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ALTITUDE,
-                      "Altitude", " m", event, &sensors_event_t::altitude,
-                      sensorsReturningFalse, retries);
-
-      // Light sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventLight,
-                      &WipperSnapper_I2C_Driver::getSensorLightPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorLightPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorLightPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_LIGHT,
-                      "Light", " lux", event, &sensors_event_t::light,
-                      sensorsReturningFalse, retries);
-
-      // PM10_STD sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventPM10_STD,
-                      &WipperSnapper_I2C_Driver::getSensorPM10_STDPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorPM10_STDPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorPM10_STDPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_STD,
-                      "PM1.0", " ppm", event, &sensors_event_t::pm10_std,
-                      sensorsReturningFalse, retries);
-
-      // PM25_STD sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventPM25_STD,
-                      &WipperSnapper_I2C_Driver::getSensorPM25_STDPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorPM25_STDPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorPM25_STDPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_STD,
-                      "PM2.5", " ppm", event, &sensors_event_t::pm25_std,
-                      sensorsReturningFalse, retries);
-
-      // PM100_STD sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventPM100_STD,
-                      &WipperSnapper_I2C_Driver::getSensorPM100_STDPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorPM100_STDPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorPM100_STDPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_STD,
-                      "PM10.0", " ppm", event, &sensors_event_t::pm100_std,
-                      sensorsReturningFalse, retries);
-
-      // Voltage sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventVoltage,
-                      &WipperSnapper_I2C_Driver::getSensorVoltagePeriod,
-                      &WipperSnapper_I2C_Driver::getSensorVoltagePeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorVoltagePeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOLTAGE,
-                      "Voltage", " V", event, &sensors_event_t::voltage,
-                      sensorsReturningFalse, retries);
-
-      // Current sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventCurrent,
-                      &WipperSnapper_I2C_Driver::getSensorCurrentPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorCurrentPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorCurrentPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CURRENT,
-                      "Current", " mA", event, &sensors_event_t::current,
-                      sensorsReturningFalse, retries);
-
-      // Unitless % sensor
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventUnitlessPercent,
-          &WipperSnapper_I2C_Driver::getSensorUnitlessPercentPeriod,
-          &WipperSnapper_I2C_Driver::getSensorUnitlessPercentPeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorUnitlessPercentPeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_UNITLESS_PERCENT,
-          "Unitless Percent", " %", event, &sensors_event_t::unitless_percent,
-          sensorsReturningFalse, retries);
-
-      // Raw sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventRaw,
-                      &WipperSnapper_I2C_Driver::getSensorRawPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorRawPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorRawPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RAW, "Raw",
-                      "", event, nullptr, sensorsReturningFalse, retries);
-
-      // Gas sensor
-      sensorEventRead(
-          iter, curTime, &msgi2cResponse,
-          &WipperSnapper_I2C_Driver::getEventGasResistance,
-          &WipperSnapper_I2C_Driver::getSensorGasResistancePeriod,
-          &WipperSnapper_I2C_Driver::getSensorGasResistancePeriodPrv,
-          &WipperSnapper_I2C_Driver::setSensorGasResistancePeriodPrv,
-          wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_GAS_RESISTANCE,
-          "Gas Resistance", " Ohms", event, &sensors_event_t::gas_resistance,
-          sensorsReturningFalse, retries);
-
-      // NOx-index sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventNOxIndex,
-                      &WipperSnapper_I2C_Driver::getSensorNOxIndexPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorNOxIndexPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorNOxIndexPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_NOX_INDEX,
-                      "NOx Index", "", event, &sensors_event_t::nox_index,
-                      sensorsReturningFalse, retries);
+      // Slow sensors convert in the background, collect when complete
+      if (!pollDriverConversion(*iter))
+        continue;
 
-      // VOC-index sensor
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventVOCIndex,
-                      &WipperSnapper_I2C_Driver::getSensorVOCIndexPeriod,
-                      &WipperSnapper_I2C_Driver::getSensorVOCIndexPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorVOCIndexPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOC_INDEX,
-                      "VOC Index", "", event, &sensors_event_t::voc_index,
-                      sensorsReturningFalse, retries);
+      // Multi-reading drivers sample the sensor once for all channels
+      (*iter)->invalidateSnapshot();
 
-      // Proximity sensor -- sends using event.data[0] same as raw sensor_type
-      sensorEventRead(iter, curTime, &msgi2cResponse,
-                      &WipperSnapper_I2C_Driver::getEventProximity,
-                      &WipperSnapper_I2C_Driver::sensorProximityPeriod,
-                      &WipperSnapper_I2C_Driver::SensorProximityPeriodPrv,
-                      &WipperSnapper_I2C_Driver::setSensorProximityPeriodPrv,
-                      wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY,
-                      "Proximity", "", event, nullptr, sensorsReturningFalse,
-                      retries);
+      // Only read the sensor types this driver was configured with
+      for (uint8_t i = 0; i < (*iter)->getSensorChannelCount(); i++) {
+        sensorEventRead(*iter, (*iter)->getSensorChannel(i), &msgi2cResponse,
+                        sensorsReturningFalse, retries);
+      }
 
       // Did this driver obtain data from sensors?
       if (msgi2cResponse.payload.resp_i2c_device_event.sensor_event_count ==
@@ -1294,81 +1154,126 @@ void WipperSnapper_Component_I2C::update() {
 
 /*******************************************************************************/
 /*!
-    @brief    Reads a sensor event from an I2C device driver.
-    @param    iter
-              An iterator pointing to the current I2C device driver.
+    @brief    Checks if any of a driver's sensor channels are due to be read.
+    @param    driver
+              The I2C device driver.
     @param    curTime
-              The current time in milliseconds.
+              The current time, in milliseconds.
+    @returns  True if at least one channel's period has elapsed.
+*/
+/*******************************************************************************/
+bool WipperSnapper_Component_I2C::isDriverDue(WipperSnapper_I2C_Driver *driver,
+                                              long curTime) {
+  for (uint8_t i = 0; i < driver->getSensorChannelCount(); i++) {
+    i2cSensorChannel &channel = driver->getSensorChannel(i);
+    if (curTime - channel.periodPrv > channel.period)
+      return true;
+  }
+  return false;
+}
+
+/*******************************************************************************/
+/*!
+    @brief    Advances a slow driver's measurement without waiting for it.
+              Starts a conversion once the driver is due and checks back on
+              later passes of update() until it completes.
+    @param    driver
+              The I2C device driver.
+    @returns  True if the driver's sensor channels can be read now, False
+              if its measurement is still converting or failed.
+*/
+/*******************************************************************************/
+bool WipperSnapper_Component_I2C::pollDriverConversion(
+    WipperSnapper_I2C_Driver *driver) {
+  // Drivers which read synchronously have nothing to wait for
+  if (driver->getConversionTime() == 0)
+    return true;
+
+  unsigned long curTime = millis();
+  if (!isDriverDue(driver, (long)curTime))
+    return true;
+
+  switch (driver->pollConversion(curTime)) {
+  case I2C_CONVERSION_READY:
+    return true;
+  case I2C_CONVERSION_PENDING: {
+    // Check back when the conversion should have completed
+    unsigned long pollTime = driver->getConversionDue();
+    if ((long)(pollTime - curTime) < I2C_CONVERSION_POLL_MS)
+      pollTime = curTime + I2C_CONVERSION_POLL_MS;
+    _nextUpdateTime = ws_scheduler::earliest(_nextUpdateTime, pollTime);
+    return false;
+  }
+  default:
+    WS_DEBUG_PRINT("ERROR: Conversion failed on sensor 0x");
+    WS_DEBUG_PRINTHEX(driver->getI2CAddress());
+    WS_DEBUG_PRINTLN("");
+    // Back off a full period before starting over, as after a failed read
+    for (uint8_t i = 0; i < driver->getSensorChannelCount(); i++) {
+      i2cSensorChannel &channel = driver->getSensorChannel(i);
+      if ((long)curTime - channel.periodPrv > channel.period)
+        channel.periodPrv = curTime;
+      _nextUpdateTime = ws_scheduler::earliest(
+          _nextUpdateTime,
+          (unsigned long)channel.periodPrv + (unsigned long)channel.period + 1);
+    }
+    return false;
+  }
+}
+
+/*******************************************************************************/
+/*!
+    @brief    Reads a sensor channel from an I2C device driver, if its period
+              has elapsed.
+    @param    driver
+              The I2C device driver.
+    @param    channel
+              The driver's sensor channel to read.
     @param    msgi2cResponse
               A pointer to the I2CResponse message.
-    @param    getEventFunc
-              A pointer to the I2C device driver's getEvent function.
-    @param    getPeriodFunc
-              A pointer to the I2C device driver's getPeriod function.
-    @param    getPeriodPrvFunc
-              A pointer to the I2C device driver's getPeriodPrv function.
-    @param    setPeriodPrvFunc
-              A pointer to the I2C device driver's setPeriodPrv function.
-    @param    sensorType
-              The type of sensor being read.
-    @param    sensorName
-              The name of the sensor being read.
-    @param    unit
-              The unit of measurement for the sensor.
-    @param    event
-              A sensors_event_t struct.
-    @param    valueMember
-              Pointer to sensors_event_t struct's value member unless data[0].
     @param    sensorsReturningFalse
               A boolean indicating if the sensor is returning false.
     @param    retries
               The number of retries left for the sensor.
 */
+/*******************************************************************************/
 void WipperSnapper_Component_I2C::sensorEventRead(
-    std::vector<WipperSnapper_I2C_Driver *>::iterator &iter,
-    unsigned long curTime, wippersnapper_signal_v1_I2CResponse *msgi2cResponse,
-    bool (WipperSnapper_I2C_Driver::*getEventFunc)(sensors_event_t *),
-    long (WipperSnapper_I2C_Driver::*getPeriodFunc)(),
-    long (WipperSnapper_I2C_Driver::*getPeriodPrvFunc)(),
-    void (WipperSnapper_I2C_Driver::*setPeriodPrvFunc)(long),
-    wippersnapper_i2c_v1_SensorType sensorType, const char *sensorName,
-    const char *unit, sensors_event_t event,
-    float sensors_event_t::*valueMember, bool &sensorsReturningFalse,
-    int &retries) {
-  // sensorName used for prefix + error message, units is value suffix
-  curTime = millis();
-  if (((*iter)->*getPeriodFunc)() != 0L &&
-      curTime - ((*iter)->*getPeriodPrvFunc)() > ((*iter)->*getPeriodFunc)()) {
+    WipperSnapper_I2C_Driver *driver, i2cSensorChannel &channel,
+    wippersnapper_signal_v1_I2CResponse *msgi2cResponse,
+    bool &sensorsReturningFalse, int &retries) {
+  long curTime = millis();
+  if (curTime - channel.periodPrv > channel.period) {
+    const i2cSensorTypeInfo *info = getSensorTypeInfo(channel.sensorType);
+    sensors_event_t event;
     // within the period, read the sensor
-    if (((*iter)->*getEventFunc)(&event)) {
-      float value;
-      if (sensorType == wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RAW ||
-          sensorType == wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY) {
-        value = event.data[0];
-      } else {
-        value = event.*valueMember;
-      }
+    if ((driver->*channel.getEvent)(&event)) {
+      float value = (info->valueMember == nullptr) ? event.data[0]
+                                                   : event.*(info->valueMember);
+      // sensorName used for prefix + error message, units is value suffix
       WS_DEBUG_PRINT("Sensor 0x");
-      WS_DEBUG_PRINTHEX((*iter)->getI2CAddress());
+      WS_DEBUG_PRINTHEX(driver->getI2CAddress());
       WS_DEBUG_PRINTLN("");
       WS_DEBUG_PRINT("\t");
-      WS_DEBUG_PRINT(sensorName);
+      WS_DEBUG_PRINT(info->name);
       WS_DEBUG_PRINT(": ");
       WS_DEBUG_PRINT(value);
-      WS_DEBUG_PRINTLN(unit);
+      WS_DEBUG_PRINTLN(info->unit);
 
       // pack event data into msg
-      fillEventMessage(msgi2cResponse, value, sensorType);
+      fillEventMessage(msgi2cResponse, value, channel.sensorType);
 
-      ((*iter)->*setPeriodPrvFunc)(curTime);
+      channel.periodPrv = curTime;
     } else {
       WS_DEBUG_PRINT("ERROR: Failed to get ");
-      WS_DEBUG_PRINT(sensorName);
+      WS_DEBUG_PRINT(info->name);
       WS_DEBUG_PRINTLN(" reading!");
       sensorsReturningFalse = true;
       if (retries == 1) {
-        ((*iter)->*setPeriodPrvFunc)(curTime);
+        channel.periodPrv = curTime;
       }
     }
   }
+  _nextUpdateTime = ws_scheduler::earliest(
+      _nextUpdateTime,
+      (unsigned long)channel.periodPrv + (unsigned long)channel.period + 1);
 }
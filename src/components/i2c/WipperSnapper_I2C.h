@@ -72,6 +72,8 @@
 #include "drivers/WipperSnapper_I2C_Driver_VL6180X.h"
 
 #define I2C_TIMEOUT_MS 50 ///< Default I2C timeout, in milliseconds.
+#define I2C_CONVERSION_POLL_MS                                                 \
+  20 ///< Time between checks on a sensor conversion, in milliseconds.
 
 // forward decl.
 class Wippersnapper;
@@ -99,19 +101,22 @@ public:
       wippersnapper_i2c_v1_I2CDeviceDeinitRequest *msgDeviceDeinitReq);
 
   void update();
+  /*******************************************************************************/
+  /*!
+      @brief    Returns when update() next has a sensor to read, as found by
+                the most recent call to update().
+      @returns  Deadline as a millis() timestamp.
+  */
+  /*******************************************************************************/
+  unsigned long getNextUpdateTime() { return _nextUpdateTime; }
 
-  void sensorEventRead(
-      std::vector<WipperSnapper_I2C_Driver *>::iterator &iter,
-      unsigned long curTime,
-      wippersnapper_signal_v1_I2CResponse *msgi2cResponse,
-      bool (WipperSnapper_I2C_Driver::*getEventFunc)(sensors_event_t *),
-      long (WipperSnapper_I2C_Driver::*getPeriodFunc)(),
-      long (WipperSnapper_I2C_Driver::*getPeriodPrvFunc)(),
-      void (WipperSnapper_I2C_Driver::*setPeriodPrvFunc)(long),
-      wippersnapper_i2c_v1_SensorType sensorType, const char *sensorName,
-      const char *unit, sensors_event_t event,
-      float sensors_event_t::*valueMember, bool &sensorsReturningFalse,
-      int &retries);
+  bool isDriverDue(WipperSnapper_I2C_Driver *driver, long curTime);
+  bool pollDriverConversion(WipperSnapper_I2C_Driver *driver);
+
+  void sensorEventRead(WipperSnapper_I2C_Driver *driver,
+                       i2cSensorChannel &channel,
+                       wippersnapper_signal_v1_I2CResponse *msgi2cResponse,
+                       bool &sensorsReturningFalse, int &retries);
 
   void fillEventMessage(wippersnapper_signal_v1_I2CResponse *msgi2cResponse,
                         float value,
@@ -131,6 +136,7 @@ private:
   TwoWire *_i2c = nullptr;
   wippersnapper_i2c_v1_BusResponse _busStatusResponse;
   std::vector<WipperSnapper_I2C_Driver *> drivers; ///< List of sensor drivers
+  unsigned long _nextUpdateTime = 0; ///< Earliest sensor deadline, in millis
   // Sensor driver objects
   WipperSnapper_I2C_Driver_AHTX0 *_ahtx0 = nullptr;
   WipperSnapper_I2C_Driver_DPS310 *_dps310 = nullptr;
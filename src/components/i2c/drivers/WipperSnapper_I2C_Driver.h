@@ -18,9 +18,31 @@
 
 #include <Adafruit_Sensor.h>
 #include <Arduino.h>
+#include <vector>
 
 #define PERIOD_24HRS_AGO_MILLIS (millis() - (24 * 60 * 60 * 1000))
 ///< Used for last sensor read time, initially set 24hrs ago (max period)
+class WipperSnapper_I2C_Driver;
+
+/** Driver method which reads a single type of sensor event */
+typedef bool (WipperSnapper_I2C_Driver::*i2cEventGetter)(sensors_event_t *);
+
+/** A sensor type which the driver has been configured to report */
+struct i2cSensorChannel {
+  wippersnapper_i2c_v1_SensorType sensorType; ///< Type of sensor reading
+  i2cEventGetter getEvent; ///< Driver method which reads the sensor
+  long period;             ///< Time between reads, in milliseconds
+  long periodPrv;          ///< When the sensor was last read, in milliseconds
+};
+
+/** Progress of a driver's background measurement */
+typedef enum {
+  I2C_CONVERSION_READY,   ///< Measurement is ready to be collected
+  I2C_CONVERSION_PENDING, ///< Measurement is in progress
+  I2C_CONVERSION_FAILED   ///< Measurement could not start or timed out
+} i2cConversionState;
+
+#define I2C_CONVERSION_TIMEOUT_FACTOR 4 ///< Timeout, in conversion times
 
 /**************************************************************************/
 /*!
@@ -71,77 +93,101 @@ public:
   void setSensorPeriod(float period,
                        wippersnapper_i2c_v1_SensorType sensorType) {
     long sensorPeriod = (long)period * 1000;
+    i2cEventGetter getEvent = nullptr;
 
     switch (sensorType) {
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE:
       _tempSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventAmbientTemp;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RELATIVE_HUMIDITY:
       _humidSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventRelativeHumidity;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PRESSURE:
       _pressureSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventPressure;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2:
       _CO2SensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventCO2;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ECO2:
       _ECO2SensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventECO2;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_TVOC:
       _TVOCSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventTVOC;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_ALTITUDE:
       _altitudeSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventAltitude;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE:
       _objectTempSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventObjectTemp;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_LIGHT:
       _lightSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventLight;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_STD:
       _PM10SensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventPM10_STD;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_STD:
       _PM25SensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventPM25_STD;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_STD:
       _PM100SensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventPM100_STD;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_UNITLESS_PERCENT:
       _unitlessPercentPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventUnitlessPercent;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOLTAGE:
       _voltagePeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventVoltage;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CURRENT:
       _currentPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventCurrent;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY:
       _proximitySensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventProximity;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_RAW:
       _rawSensorPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventRaw;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT:
       _ambientTempFPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventAmbientTempF;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_OBJECT_TEMPERATURE_FAHRENHEIT:
       _objectTempFPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventObjectTempF;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_GAS_RESISTANCE:
       _gasResistancePeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventGasResistance;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_NOX_INDEX:
       _NOxIndexPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventNOxIndex;
       break;
     case wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_VOC_INDEX:
       _VOCIndexPeriod = sensorPeriod;
+      getEvent = &WipperSnapper_I2C_Driver::getEventVOCIndex;
       break;
     default:
-      break;
+      return;
     }
+    setSensorChannel(sensorType, getEvent, sensorPeriod);
   }
 
   /*******************************************************************************/
@@ -164,6 +210,95 @@ public:
     }
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads all of the sensor's measurements at once and stores
+                them for the getEvent*() methods. Drivers which obtain
+                several readings from one bus transaction override this.
+      @returns  True if the measurements were read successfully, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  virtual bool readAll() { return true; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Discards the stored measurements so the next getEvent*() call
+                reads the sensor again. Called at the start of every poll.
+  */
+  /*******************************************************************************/
+  void invalidateSnapshot() { _snapshotRead = false; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Starts a measurement on a sensor which takes a long time to
+                convert. Drivers which override this must also override
+                getConversionTime().
+      @returns  True if the measurement was started, False otherwise.
+  */
+  /*******************************************************************************/
+  virtual bool startConversion() { return true; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Checks if the measurement started by startConversion() has
+                completed, without waiting for it.
+      @returns  True if the measurement can be collected, False otherwise.
+  */
+  /*******************************************************************************/
+  virtual bool conversionReady() { return true; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the typical time a measurement takes to convert.
+      @returns  Conversion time in milliseconds, 0 if the driver reads its
+                sensor synchronously from the getEvent*() methods.
+  */
+  /*******************************************************************************/
+  virtual unsigned long getConversionTime() { return 0; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Advances the driver's measurement without blocking. Starts a
+                conversion if none is in progress, otherwise checks whether
+                it has completed or timed out.
+      @param    curTime
+                The current time, in milliseconds.
+      @returns  I2C_CONVERSION_READY once the getEvent*() methods can
+                collect the measurement.
+  */
+  /*******************************************************************************/
+  i2cConversionState pollConversion(unsigned long curTime) {
+    if (!_conversionPending) {
+      if (!startConversion())
+        return I2C_CONVERSION_FAILED;
+      _conversionPending = true;
+      _conversionStart = curTime;
+    }
+    // Continuously converting sensors may already have a measurement
+    if (conversionReady()) {
+      _conversionPending = false;
+      return I2C_CONVERSION_READY;
+    }
+    if (curTime - _conversionStart >
+        I2C_CONVERSION_TIMEOUT_FACTOR * getConversionTime()) {
+      _conversionPending = false;
+      return I2C_CONVERSION_FAILED;
+    }
+    return I2C_CONVERSION_PENDING;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the time at which the measurement in progress is
+                expected to complete.
+      @returns  Expected completion time, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionDue() {
+    return _conversionStart + getConversionTime();
+  }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the I2C device's address.
@@ -172,6 +307,26 @@ public:
   /*******************************************************************************/
   uint16_t getI2CAddress() { return _sensorAddress; }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the number of sensor types the driver reports.
+      @returns  Number of configured sensor channels.
+  */
+  /*******************************************************************************/
+  uint8_t getSensorChannelCount() { return _sensorChannels.size(); }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets a configured sensor channel.
+      @param    idx
+                Index of the channel, less than getSensorChannelCount().
+      @returns  Reference to the sensor channel.
+  */
+  /*******************************************************************************/
+  i2cSensorChannel &getSensorChannel(uint8_t idx) {
+    return _sensorChannels[idx];
+  }
+
   /****************************** SENSOR_TYPE: CO2
    * *******************************/
   /*********************************************************************************/
@@ -183,26 +338,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorCO2Period() { return _CO2SensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the co2 sensor was queried last.
-      @returns  Time when the co2 sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorCO2PeriodPrv() { return _CO2SensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the co2 sensor was queried.
-      @param    period
-                The time when the co2 sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorCO2PeriodPrv(long period) {
-    _CO2SensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Gets a sensor's CO2 value.
@@ -229,26 +364,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorECO2Period() { return _ECO2SensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the eCO2 sensor was queried last.
-      @returns  Time when the eCO2 sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorECO2PeriodPrv() { return _ECO2SensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the eCO2 sensor was queried.
-      @param    period
-                The time when the CO2 sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorECO2PeriodPrv(long period) {
-    _ECO2SensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Gets a sensor's eCO2 value.
@@ -275,26 +390,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorTVOCPeriod() { return _TVOCSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the TVOC sensor was queried last.
-      @returns  Time when the TVOC sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorTVOCPeriodPrv() { return _TVOCSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the TVOC sensor was queried.
-      @param    period
-                The time when the TVOC sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorTVOCPeriodPrv(long period) {
-    _TVOCSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Gets a sensor's TVOC value.
@@ -321,29 +416,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorAmbientTempPeriod() { return _tempSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the ambient temperature sensor (°C) was queried last.
-      @returns  Time when the ambient temperature sensor (°C) was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorAmbientTempPeriodPrv() { return _tempSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the ambient temperature sensor (°C)
-                was queried.
-      @param    periodPrv
-                The time when the ambient temperature sensor (°C) was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorAmbientTempPeriodPrv(long periodPrv) {
-    _tempSensorPeriodPrv = periodPrv;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads an ambient temperature sensor (°C).
@@ -371,28 +443,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorRelativeHumidityPeriod() { return _humidSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-     which the humidity sensor was queried last.
-      @returns  Time when the humidity sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorRelativeHumidityPeriodPrv() {
-    return _humidSensorPeriodPrv;
-  }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the temperature sensor was queried.
-      @param    periodPrv
-                The time when the temperature sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorRelativeHumidityPeriodPrv(long periodPrv) {
-    _humidSensorPeriodPrv = periodPrv;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a humidity sensor and converts
@@ -420,26 +470,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorPressurePeriod() { return _pressureSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the pressure sensor was queried last.
-      @returns  Time when the pressure sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorPressurePeriodPrv() { return _pressureSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the pressure sensor was queried.
-      @param    period
-                The time when the pressure sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorPressurePeriodPrv(long period) {
-    _pressureSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a pressure sensor and converts
@@ -467,26 +497,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorAltitudePeriod() { return _altitudeSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the Altitude sensor was queried last.
-      @returns  Time when the Altitude sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorAltitudePeriodPrv() { return _altitudeSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the Altitude sensor was queried.
-      @param    period
-                The time when the Altitude sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorAltitudePeriodPrv(long period) {
-    _altitudeSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a Altitude sensor and converts
@@ -515,30 +525,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorObjectTempPeriod() { return _objectTempSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the object temperature sensor was queried last.
-      @returns  Time when the object temperature sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorObjectTempPeriodPrv() {
-    return _objectTempSensorPeriodPrv;
-  }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the object temperature sensor
-                was queried.
-      @param    period
-                The time when the object temperature sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorObjectTempPeriodPrv(long period) {
-    _objectTempSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object temperature sensor and
@@ -567,28 +553,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorLightPeriod() { return _lightSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the light sensor was queried last.
-      @returns  Time when the light sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorLightPeriodPrv() { return _lightSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the light sensor
-                was queried.
-      @param    period
-                The time when the light sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorLightPeriodPrv(long period) {
-    _lightSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object light sensor and
@@ -617,28 +581,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorPM10_STDPeriod() { return _PM10SensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the pm10 std. sensor was queried last.
-      @returns  Time when the pm10 std. sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorPM10_STDPeriodPrv() { return _PM10SensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the light sensor
-                was queried.
-      @param    period
-                The time when the light sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorPM10_STDPeriodPrv(long period) {
-    _PM10SensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object pm10 std. sensor and
@@ -667,28 +609,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorPM25_STDPeriod() { return _PM25SensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the pm25 std. sensor was queried last.
-      @returns  Time when the pm25 std. sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorPM25_STDPeriodPrv() { return _PM25SensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the light sensor
-                was queried.
-      @param    period
-                The time when the light sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorPM25_STDPeriodPrv(long period) {
-    _PM25SensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object pm25 std. sensor and
@@ -717,28 +637,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorPM100_STDPeriod() { return _PM100SensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the pm100 std. sensor was queried last.
-      @returns  Time when the pm100 std. sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorPM100_STDPeriodPrv() { return _PM100SensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the light sensor
-                was queried.
-      @param    period
-                The time when the light sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorPM100_STDPeriodPrv(long period) {
-    _PM100SensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object pm100 std. sensor and
@@ -769,30 +667,6 @@ public:
     return _unitlessPercentPeriod;
   }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the unitless % sensor was queried last.
-      @returns  Time when the unitless % sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorUnitlessPercentPeriodPrv() {
-    return _unitlessPercentPeriodPrv;
-  }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the unitless % sensor
-                was queried.
-      @param    period
-                The time when the unitless % sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorUnitlessPercentPeriodPrv(long period) {
-    _unitlessPercentPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a object unitless % std. sensor and
@@ -820,26 +694,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorVoltagePeriod() { return _voltagePeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the voltage sensor was queried last.
-      @returns  Time when the voltage sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorVoltagePeriodPrv() { return _voltagePeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the voltage sensor was queried.
-      @param    period
-                The time when the voltage sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorVoltagePeriodPrv(long period) {
-    _voltagePeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a voltage sensor and converts the
@@ -867,26 +721,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorCurrentPeriod() { return _currentPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the current sensor was queried last.
-      @returns  Time when the current sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorCurrentPeriodPrv() { return _currentPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the current sensor was queried.
-      @param    period
-                The time when the current sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorCurrentPeriodPrv(long period) {
-    _currentPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a current sensor and converts the
@@ -914,26 +748,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorRawPeriod() { return _rawSensorPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the raw sensor was queried last.
-      @returns  Time when the raw sensor was last queried, in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorRawPeriodPrv() { return _rawSensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the raw sensor was queried.
-      @param    period
-                The time when the raw sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorRawPeriodPrv(long period) {
-    _rawSensorPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Gets a sensor's Raw value.
@@ -958,7 +772,11 @@ public:
      exists.
   */
   /*******************************************************************************/
-  virtual void disableAmbientTempF() { _ambientTempFPeriod = 0.0L; }
+  virtual void disableAmbientTempF() {
+    setSensorPeriod(
+        0,
+        wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_AMBIENT_TEMPERATURE_FAHRENHEIT);
+  }
 
   /*********************************************************************************/
   /*!
@@ -970,31 +788,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorAmbientTempFPeriod() { return _ambientTempFPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the ambient temperature sensor (°F) was queried last.
-      @returns  Time when the ambient temperature sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorAmbientTempFPeriodPrv() {
-    return _ambientTempFPeriodPrv;
-  }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the ambient temperature sensor (°F)
-                was queried.
-      @param    period
-                The time when the ambient temperature sensor (°F) was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorAmbientTempFPeriodPrv(long period) {
-    _ambientTempFPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Helper function to obtain a sensor's ambient temperature value
@@ -1028,29 +821,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorObjectTempFPeriod() { return _objectTempFPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the object temperature sensor (°F) was queried last.
-      @returns  Time when the object temperature sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorObjectTempFPeriodPrv() { return _objectTempFPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the object temperature sensor (°F)
-                was queried.
-      @param    period
-                The time when the object temperature sensor (°F) was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorObjectTempFPeriodPrv(long period) {
-    _objectTempFPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Helper function to obtain a sensor's object temperature value
@@ -1084,31 +854,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorGasResistancePeriod() { return _gasResistancePeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the gas resistance sensor (ohms) was queried last.
-      @returns  Time when the gas resistance sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorGasResistancePeriodPrv() {
-    return _gasResistancePeriodPrv;
-  }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the object gas resistance sensor
-                was queried.
-      @param    period
-                The time when the gas resistance sensor was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorGasResistancePeriodPrv(long period) {
-    _gasResistancePeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a gas resistance sensor and converts
@@ -1137,29 +882,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorNOxIndexPeriod() { return _NOxIndexPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the NOx Index sensor was queried last.
-      @returns  Time when the NOx Index sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorNOxIndexPeriodPrv() { return _NOxIndexPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the object NOx Index sensor
-                was queried.
-      @param    period
-                The time when the NOx Index sensor was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorNOxIndexPeriodPrv(long period) {
-    _NOxIndexPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a NOx Index sensor and converts
@@ -1188,29 +910,6 @@ public:
   /*********************************************************************************/
   virtual long getSensorVOCIndexPeriod() { return _VOCIndexPeriod; }
 
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                which the VOC Index sensor was queried last.
-      @returns  Time when the VOC Index sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long getSensorVOCIndexPeriodPrv() { return _VOCIndexPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the object VOC Index sensor
-                was queried.
-      @param    period
-                The time when the VOC Index sensor was queried
-     last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorVOCIndexPeriodPrv(long period) {
-    _VOCIndexPeriodPrv = period;
-  }
-
   /*******************************************************************************/
   /*!
       @brief    Base implementation - Reads a VOC Index sensor and converts
@@ -1241,7 +940,9 @@ public:
       @brief    Disables the device's object proximity sensor, if it exists.
   */
   /*******************************************************************************/
-  virtual void disableSensorProximity() { _proximitySensorPeriod = 0.0L; }
+  virtual void disableSensorProximity() {
+    setSensorPeriod(0, wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY);
+  }
 
   /*********************************************************************************/
   /*!
@@ -1262,31 +963,13 @@ public:
   */
   /*******************************************************************************/
   virtual void setSensorProximityPeriod(long period) {
-    if (period == 0)
+    if (period == 0) {
       disableSensorProximity();
+      return;
+    }
     _proximitySensorPeriod = period;
-  }
-
-  /*********************************************************************************/
-  /*!
-      @brief    Base implementation - Returns the previous time interval at
-                    which the proximity sensor was queried last.
-      @returns  Time when the proximity sensor was last queried,
-                in seconds.
-  */
-  /*********************************************************************************/
-  virtual long SensorProximityPeriodPrv() { return _proximitySensorPeriodPrv; }
-
-  /*******************************************************************************/
-  /*!
-      @brief    Sets a timestamp for when the proximity sensor
-                was queried.
-      @param    period
-                The time when the proximity sensor was queried last.
-  */
-  /*******************************************************************************/
-  virtual void setSensorProximityPeriodPrv(long period) {
-    _proximitySensorPeriodPrv = period;
+    setSensorChannel(wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PROXIMITY,
+                     &WipperSnapper_I2C_Driver::getEventProximity, period);
   }
 
   /*******************************************************************************/
@@ -1318,112 +1001,104 @@ public:
   }
 
 protected:
-  TwoWire *_i2c;           ///< Pointer to the I2C driver's Wire object
+  /*******************************************************************************/
+  /*!
+      @brief    Calls readAll() once per poll, shared by every getEvent*()
+                method.
+      @returns  True if the stored measurements are valid, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readSnapshot() {
+    if (!_snapshotRead) {
+      _snapshotValid = readAll();
+      _snapshotRead = true;
+    }
+    return _snapshotValid;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Adds, updates or removes the channel for a sensor type.
+      @param    sensorType
+                The type of sensor reading.
+      @param    getEvent
+                Driver method which reads the sensor.
+      @param    period
+                Time between reads, in milliseconds, 0 to disable.
+  */
+  /*******************************************************************************/
+  void setSensorChannel(wippersnapper_i2c_v1_SensorType sensorType,
+                        i2cEventGetter getEvent, long period) {
+    std::vector<i2cSensorChannel>::iterator iter;
+    for (iter = _sensorChannels.begin(); iter != _sensorChannels.end();
+         ++iter) {
+      if (iter->sensorType == sensorType)
+        break;
+    }
+
+    if (period == 0L) {
+      if (iter != _sensorChannels.end())
+        _sensorChannels.erase(iter);
+    } else if (iter != _sensorChannels.end()) {
+      iter->period = period;
+    } else {
+      _sensorChannels.push_back(
+          {sensorType, getEvent, period, (long)PERIOD_24HRS_AGO_MILLIS});
+    }
+  }
+
+  std::vector<i2cSensorChannel>
+      _sensorChannels; ///< Sensor types the driver has been configured to read
+  TwoWire *_i2c;       ///< Pointer to the I2C driver's Wire object
   uint16_t _sensorAddress; ///< The I2C driver's unique I2C address.
   long _tempSensorPeriod =
       0L; ///< The time period between reading the temperature sensor's value.
-  long _tempSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the temperature sensor was
-                               ///< last read
   long _humidSensorPeriod =
       0L; ///< The time period between reading the humidity sensor's value.
-  long _humidSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the humidity sensor was last
-                               ///< read.
   long _pressureSensorPeriod =
       0L; ///< The time period between reading the pressure sensor's value.
-  long _pressureSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the pressure sensor was last
-                               ///< read.
   long _CO2SensorPeriod =
       0L; ///< The time period between reading the CO2 sensor's value.
-  long _CO2SensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the CO2 sensor was last read.
   long _ECO2SensorPeriod =
       0L; ///< The time period between reading the eCO2 sensor's value.
-  long _ECO2SensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the eCO2 sensor was last read.
   long _TVOCSensorPeriod =
       0L; ///< The time period between reading the TVOC sensor's value.
-  long _TVOCSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the TVOC sensor was last read.
   long _altitudeSensorPeriod =
       0L; ///< The time period between reading the altitude sensor's value.
-  long _altitudeSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the altitude sensor was last
-                               ///< read.
   long _objectTempSensorPeriod = 0L; ///< The time period between reading the
                                      ///< object temperature sensor's value.
-  long _objectTempSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the object temperature sensor
-                               ///< was last read.
   long _lightSensorPeriod =
       0L; ///< The time period between reading the light sensor's value.
-  long _lightSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the light sensor was last
-                               ///< read.
   long _PM10SensorPeriod =
       0L; ///< The time period between reading the pm25 sensor's value.
-  long _PM10SensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the pm25 sensor was last read.
   long _PM25SensorPeriod =
       0L; ///< The time period between reading the pm25 sensor's value.
-  long _PM25SensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the pm25 sensor was last read.
   long _PM100SensorPeriod =
       0L; ///< The time period between reading the pm100_std sensor's value.
-  long _PM100SensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the pm100_std sensor was last
-                               ///< read.
   long _unitlessPercentPeriod =
       0L; ///< The time period between reading the unitless % sensor's value.
-  long _unitlessPercentPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the unitless % sensor was last
-                               ///< read.
   long _voltagePeriod =
       0L; ///< The time period between reading the voltage sensor's value.
-  long _voltagePeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the voltage sensor was last
-                               ///< read.
   long _currentPeriod =
       0L; ///< The time period between reading the current sensor's value.
-  long _currentPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the current sensor was last
-                               ///< read.
   long _rawSensorPeriod =
       0L; ///< The time period between reading the Raw sensor's value.
-  long _rawSensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the Raw sensor was last read.
   long _ambientTempFPeriod = 0L; ///< The time period between reading the
                                  ///< ambient temp. (°F) sensor's value.
-  long _ambientTempFPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the ambient temp. (°F) sensor
-                               ///< was last read.
   long _objectTempFPeriod = 0L; ///< The time period between reading the object
                                 ///< temp. (°F) sensor's value.
-  long _objectTempFPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the object temp. (°F) sensor
-                               ///< was last read.
   long _gasResistancePeriod = 0L; ///< The time period between reading the gas
                                   ///< resistance sensor's value.
-  long _gasResistancePeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the gas resistance sensor was
-                               ///< last read.
   long _NOxIndexPeriod =
       0L; ///< The time period between reading the NOx Index sensor's value.
-  long _NOxIndexPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the NOx Index sensor was last
-                               ///< read.
   long _VOCIndexPeriod =
       0L; ///< The time period between reading the VOC Index sensor's value.
-  long _VOCIndexPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the VOC Index sensor was last
-                               ///< read.
   long _proximitySensorPeriod =
       0L; ///< The time period between reading the proximity sensor's value.
-  long _proximitySensorPeriodPrv =
-      PERIOD_24HRS_AGO_MILLIS; ///< The time when the proximity sensor was last
-                               ///< read.
+  bool _snapshotRead = false;         ///< True if readAll() ran this poll
+  bool _snapshotValid = false;        ///< Result of the last readAll()
+  bool _conversionPending = false;    ///< True while a measurement converts
+  unsigned long _conversionStart = 0; ///< When the measurement was started
 };
 
 #endif // WipperSnapper_I2C_Driver_H
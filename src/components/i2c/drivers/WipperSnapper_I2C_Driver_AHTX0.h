@@ -63,13 +63,19 @@ public:
     if (!_aht->begin(_i2c, (int32_t)_sensorAddress))
       return false;
 
-    // get temperature and humidity sensor
-    _aht_temp = _aht->getTemperatureSensor();
-    _aht_humidity = _aht->getHumiditySensor();
-
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads temperature and humidity from the AHTX0 in a single
+                measurement.
+      @returns  True if the measurement was read successfully, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _aht->getEvent(&_humidity, &_temp); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the AHTX0's current temperature.
@@ -80,11 +86,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    // is sensor enabled correctly?
-    if (_aht_temp == NULL)
+    if (!readSnapshot())
       return false;
-    // get event
-    _aht_temp->getEvent(tempEvent);
+    tempEvent->temperature = _temp.temperature;
     return true;
   }
 
@@ -98,20 +102,16 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    // is sensor enabled correctly?
-    if (_aht_humidity == NULL)
+    if (!readSnapshot())
       return false;
-    // get humidity
-    _aht_humidity->getEvent(humidEvent);
+    humidEvent->relative_humidity = _humidity.relative_humidity;
     return true;
   }
 
 protected:
-  Adafruit_AHTX0 *_aht; ///< Pointer to an AHTX0 object
-  Adafruit_Sensor *_aht_temp =
-      NULL; ///< Holds data for the AHTX0's temperature sensor
-  Adafruit_Sensor *_aht_humidity =
-      NULL; ///< Holds data for the AHTX0's humidity sensor
+  Adafruit_AHTX0 *_aht;      ///< Pointer to an AHTX0 object
+  sensors_event_t _temp;     ///< Holds data for the AHTX0's temperature sensor
+  sensors_event_t _humidity; ///< Holds data for the AHTX0's humidity sensor
 };
 
 #endif // WipperSnapper_I2C_Driver_AHTX0
\ No newline at end of file
@@ -63,13 +63,22 @@ public:
     // attempt to initialize BME280
     if (!_bme->begin(_sensorAddress, _i2c))
       return false;
-    // configure BME280 device
-    _bme_temp = _bme->getTemperatureSensor();
-    _bme_humidity = _bme->getHumiditySensor();
-    _bme_pressure = _bme->getPressureSensor();
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads temperature, humidity and pressure from the BME280.
+      @returns  True if the readings are valid, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() {
+    _temperature = _bme->readTemperature();
+    _humidity = _bme->readHumidity();
+    _pressure = _bme->readPressure() / 100.0F;
+    return !isnan(_temperature) && !isnan(_humidity) && !isnan(_pressure);
+  }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the BME280's current temperature.
@@ -80,9 +89,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    if (_bme_temp == NULL)
+    if (!readSnapshot())
       return false;
-    _bme_temp->getEvent(tempEvent);
+    tempEvent->temperature = _temperature;
     return true;
   }
 
@@ -96,9 +105,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    if (_bme_humidity == NULL)
+    if (!readSnapshot())
       return false;
-    _bme_humidity->getEvent(humidEvent);
+    humidEvent->relative_humidity = _humidity;
     return true;
   }
 
@@ -113,9 +122,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventPressure(sensors_event_t *pressureEvent) {
-    if (_bme_pressure == NULL)
+    if (!readSnapshot())
       return false;
-    _bme_pressure->getEvent(pressureEvent);
+    pressureEvent->pressure = _pressure;
     return true;
   }
 
@@ -129,18 +138,19 @@ public:
   */
   /*******************************************************************************/
   bool getEventAltitude(sensors_event_t *altitudeEvent) {
-    altitudeEvent->altitude = _bme->readAltitude(SEALEVELPRESSURE_HPA);
+    if (!readSnapshot())
+      return false;
+    // computed from the snapshot, readAltitude() would sample again
+    altitudeEvent->altitude =
+        44330.0 * (1.0 - pow(_pressure / SEALEVELPRESSURE_HPA, 0.1903));
     return true;
   }
 
 protected:
   Adafruit_BME280 *_bme; ///< BME280  object
-  Adafruit_Sensor *_bme_temp =
-      NULL; ///< Ptr to an adafruit_sensor representing the temperature
-  Adafruit_Sensor *_bme_pressure =
-      NULL; ///< Ptr to an adafruit_sensor representing the pressure
-  Adafruit_Sensor *_bme_humidity =
-      NULL; ///< Ptr to an adafruit_sensor representing the humidity
+  float _temperature;    ///< Temperature, in degrees C
+  float _humidity;       ///< Relative humidity, in %RH
+  float _pressure;       ///< Pressure, in hPa
 };
 
 #endif // WipperSnapper_I2C_Driver_BME280
\ No newline at end of file
@@ -79,11 +79,12 @@ public:
 
   /*******************************************************************************/
   /*!
-      @brief    Performs a reading in blocking mode.
+      @brief    Performs a reading in blocking mode, sampling temperature,
+                humidity, pressure and gas resistance at once.
       @returns  True if the reading succeeded, False otherwise.
   */
   /*******************************************************************************/
-  bool bmePerformReading() { return _bme->performReading(); }
+  bool readAll() { return _bme->performReading(); }
 
   /*******************************************************************************/
   /*!
@@ -95,7 +96,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    if (!bmePerformReading())
+    if (!readSnapshot())
       return false;
     tempEvent->temperature = _bme->temperature;
     return true;
@@ -111,7 +112,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    if (!bmePerformReading())
+    if (!readSnapshot())
       return false;
     humidEvent->relative_humidity = _bme->humidity;
     return true;
@@ -128,7 +129,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventPressure(sensors_event_t *pressureEvent) {
-    if (!bmePerformReading())
+    if (!readSnapshot())
       return false;
     pressureEvent->pressure = (float)_bme->pressure / 100.0;
     return true;
@@ -144,9 +145,12 @@ public:
   */
   /*******************************************************************************/
   bool getEventAltitude(sensors_event_t *altitudeEvent) {
-    if (!bmePerformReading())
+    if (!readSnapshot())
       return false;
-    altitudeEvent->altitude = (float)_bme->readAltitude(SEALEVELPRESSURE_HPA);
+    // computed from the snapshot, readAltitude() would sample again
+    float atmospheric = (float)_bme->pressure / 100.0F;
+    altitudeEvent->altitude =
+        44330.0 * (1.0 - pow(atmospheric / SEALEVELPRESSURE_HPA, 0.1903));
     return true;
   }
 
@@ -161,7 +165,7 @@ public:
   */
   /*******************************************************************************/
   virtual bool getEventGasResistance(sensors_event_t *gasEvent) {
-    if (!bmePerformReading())
+    if (!readSnapshot())
       return false;
 
     gasEvent->gas_resistance = (float)_bme->gas_resistance;
@@ -70,13 +70,21 @@ public:
                       Adafruit_BMP280::SAMPLING_X16, /* Pressure oversampling */
                       Adafruit_BMP280::FILTER_X16,   /* Filtering. */
                       Adafruit_BMP280::STANDBY_MS_500); /* Standby time. */
-
-    // configure BMP280 device
-    _bmp_temp = _bmp->getTemperatureSensor();
-    _bmp_pressure = _bmp->getPressureSensor();
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads temperature and pressure from the BMP280.
+      @returns  True if the readings are valid, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() {
+    _temperature = _bmp->readTemperature();
+    _pressure = _bmp->readPressure() / 100.0F;
+    return !isnan(_temperature) && !isnan(_pressure);
+  }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the BMP280's current temperature.
@@ -87,9 +95,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    if (_bmp_temp == NULL)
+    if (!readSnapshot())
       return false;
-    _bmp_temp->getEvent(tempEvent);
+    tempEvent->temperature = _temperature;
     return true;
   }
 
@@ -104,9 +112,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventPressure(sensors_event_t *pressureEvent) {
-    if (_bmp_pressure == NULL)
+    if (!readSnapshot())
       return false;
-    _bmp_pressure->getEvent(pressureEvent);
+    pressureEvent->pressure = _pressure;
     return true;
   }
 
@@ -120,18 +128,18 @@ public:
   */
   /*******************************************************************************/
   bool getEventAltitude(sensors_event_t *altitudeEvent) {
-    altitudeEvent->altitude = _bmp->readAltitude(SEALEVELPRESSURE_HPA);
+    if (!readSnapshot())
+      return false;
+    // computed from the snapshot, readAltitude() would sample again
+    altitudeEvent->altitude =
+        44330.0 * (1.0 - pow(_pressure / SEALEVELPRESSURE_HPA, 0.1903));
     return true;
   }
 
 protected:
   Adafruit_BMP280 *_bmp; ///< BMP280  object
-  Adafruit_Sensor *_bmp_temp =
-      NULL; ///< Ptr to an adafruit_sensor representing the temperature
-  Adafruit_Sensor *_bmp_pressure =
-      NULL; ///< Ptr to an adafruit_sensor representing the pressure
-  Adafruit_Sensor *_bmp_humidity =
-      NULL; ///< Ptr to an adafruit_sensor representing the humidity
+  float _temperature;    ///< Temperature, in degrees C
+  float _pressure;       ///< Pressure, in hPa
 };
 
 #endif // WipperSnapper_I2C_Driver_BMP280
\ No newline at end of file
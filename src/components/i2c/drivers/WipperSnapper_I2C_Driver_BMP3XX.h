@@ -73,6 +73,14 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Performs a temperature and pressure reading in blocking mode.
+      @returns  True if the reading succeeded, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _bmp3xx->performReading(); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the BMP3XX's current temperature.
@@ -83,7 +91,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    if (!_bmp3xx->performReading())
+    if (!readSnapshot())
       return false;
     tempEvent->temperature = _bmp3xx->temperature;
     return true;
@@ -100,7 +108,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventPressure(sensors_event_t *pressureEvent) {
-    if (!_bmp3xx->performReading())
+    if (!readSnapshot())
       return false;
     pressureEvent->pressure = _bmp3xx->pressure / 100.0F;
     return true;
@@ -116,9 +124,12 @@ public:
   */
   /*******************************************************************************/
   bool getEventAltitude(sensors_event_t *altitudeEvent) {
-    if (!_bmp3xx->performReading())
+    if (!readSnapshot())
       return false;
-    altitudeEvent->altitude = _bmp3xx->readAltitude(SEALEVELPRESSURE_HPA);
+    // computed from the snapshot, readAltitude() would sample again
+    float atmospheric = _bmp3xx->pressure / 100.0F;
+    altitudeEvent->altitude =
+        44330.0 * (1.0 - pow(atmospheric / SEALEVELPRESSURE_HPA, 0.1903));
     return true;
   }
 
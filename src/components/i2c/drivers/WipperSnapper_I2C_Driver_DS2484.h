@@ -20,6 +20,7 @@
 #define DS18B20_CMD_CONVERT_T 0x44       ///< Convert T command
 #define DS18B20_CMD_MATCH_ROM 0x55       ///< Match ROM command
 #define DS18B20_CMD_READ_SCRATCHPAD 0xBE ///< Read Scratchpad command
+#define DS18B20_CONVERSION_MS 750        ///< 12-bit conversion time
 
 #include "WipperSnapper_I2C_Driver.h"
 #include <Adafruit_DS248x.h>
@@ -106,40 +107,78 @@ public:
 
   /*******************************************************************************/
   /*!
-      @brief    Processes a temperature event.
-      @param    tempEvent
-                Pointer to an Adafruit_Sensor event.
-      @returns  True if the temperature was obtained successfully, False
-                otherwise.
+      @brief    Addresses the DS18B20 on the 1-Wire bus.
+      @returns  True if the bus was reset successfully, False otherwise.
   */
-  bool processTemperatureEvent(sensors_event_t *tempEvent) {
+  /*******************************************************************************/
+  bool selectDevice() {
     if (!_ds2484->OneWireReset()) {
       WS_DEBUG_PRINTLN("Failed to do a OneWire bus reset");
       return false;
     }
-    if (!_ds2484->presencePulseDetected()) {
-      tempEvent->temperature = NAN;
+    _present = _ds2484->presencePulseDetected();
+    if (!_present)
       return true;
-    }
 
     _ds2484->OneWireWriteByte(DS18B20_CMD_MATCH_ROM); // Match ROM command
     for (int i = 0; i < 8; i++) {
       _ds2484->OneWireWriteByte(_rom[i]);
     }
+    return true;
+  }
 
-    // Start temperature conversion
-    _ds2484->OneWireWriteByte(DS18B20_CMD_CONVERT_T); // Convert T command
-    delay(750); // Wait for conversion (750ms for maximum precision)
+  /*******************************************************************************/
+  /*!
+      @brief    Starts a DS18B20 temperature conversion.
+      @returns  True if the conversion was started, False otherwise.
+  */
+  /*******************************************************************************/
+  bool startConversion() {
+    if (!selectDevice())
+      return false;
+    if (_present)
+      _ds2484->OneWireWriteByte(DS18B20_CMD_CONVERT_T); // Convert T command
+    return true;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Checks if the temperature conversion has had time to complete.
+      @returns  True if the conversion has completed, False otherwise.
+  */
+  /*******************************************************************************/
+  bool conversionReady() {
+    return !_present || millis() - _conversionStart >= getConversionTime();
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the DS18B20's conversion time.
+      @returns  Conversion time at maximum precision, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return DS18B20_CONVERSION_MS; }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the DS2484's current temperature, read from the
+                conversion started by startConversion().
+      @param    tempEvent
+                Pointer to an Adafruit_Sensor event.
+      @returns  True if the temperature was obtained successfully, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  bool getEventAmbientTemp(sensors_event_t *tempEvent) {
     // Read scratchpad
-    if (!_ds2484->OneWireReset()) {
+    if (_present && !selectDevice()) {
       WS_DEBUG_PRINTLN(
           "Failed to do a OneWire bus reset after starting temp conversion");
       return false;
     }
-    _ds2484->OneWireWriteByte(DS18B20_CMD_MATCH_ROM); // Match ROM command
-    for (int i = 0; i < 8; i++) {
-      _ds2484->OneWireWriteByte(_rom[i]);
+    if (!_present) {
+      tempEvent->temperature = NAN;
+      return true;
     }
     _ds2484->OneWireWriteByte(
         DS18B20_CMD_READ_SCRATCHPAD); // Read Scratchpad command
@@ -155,22 +194,10 @@ public:
     return true;
   }
 
-  /*******************************************************************************/
-  /*!
-      @brief    Gets the DS2484's current temperature.
-      @param    tempEvent
-                Pointer to an Adafruit_Sensor event.
-      @returns  True if the temperature was obtained successfully, False
-                otherwise.
-  */
-  /*******************************************************************************/
-  bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    return processTemperatureEvent(tempEvent);
-  }
-
 protected:
   Adafruit_DS248x *_ds2484; ///< DS2484 driver object
   uint8_t _rom[8];          ///< DS18B20 ROM
+  bool _present = false;    ///< True if the DS18B20 answered the bus reset
 };
 
-#endif // WipperSnapper_I2C_Driver_DS2484
\ No newline at end of file
+#endif // WipperSnapper_I2C_Driver_DS2484
\ No newline at end of file
@@ -75,7 +75,7 @@ public:
       @returns  True if the reading succeeded, False otherwise.
   */
   /*******************************************************************************/
-  bool ensPerformReading() {
+  bool readAll() {
     return _ens160->available() && _ens160->measure(true);
   }
 
@@ -89,7 +89,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventECO2(sensors_event_t *eco2Event) {
-    if (!ensPerformReading())
+    if (!readSnapshot())
       return false;
     eco2Event->eCO2 = (float)_ens160->geteCO2();
     return true;
@@ -105,7 +105,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventTVOC(sensors_event_t *tvocEvent) {
-    if (!ensPerformReading())
+    if (!readSnapshot())
       return false;
     tvocEvent->tvoc = (float)_ens160->getTVOC();
     return true;
@@ -121,7 +121,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventRaw(sensors_event_t *rawEvent) {
-    if (!ensPerformReading())
+    if (!readSnapshot())
       return false;
     rawEvent->data[0] = (float)_ens160->getAQI();
     return true;
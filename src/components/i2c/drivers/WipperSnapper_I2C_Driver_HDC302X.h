@@ -68,7 +68,7 @@ public:
       @returns  True if the data was read successfully, False otherwise.
   */
   /*******************************************************************************/
-  bool readSensorData() {
+  bool readAll() {
     uint16_t status = _hdc302x->readStatus();
     if (status & 0x0010) {
       WS_DEBUG_PRINTLN(F("Device Reset Detected"));
@@ -99,7 +99,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    if (readSensorData() == false)
+    if (readSnapshot() == false)
       return false;
     tempEvent->temperature = _temp;
     return true;
@@ -115,7 +115,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    if (readSensorData() == false)
+    if (readSnapshot() == false)
       return false;
     humidEvent->relative_humidity = _humidity;
     return true;
@@ -54,6 +54,16 @@ public:
     return _htu31d->begin(_sensorAddress, _i2c);
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads temperature and humidity from the HTU31D in a single
+                conversion.
+      @returns  True if the conversion was read successfully, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _htu31d->getEvent(&_humidity, &_temp); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the HTU31D's current temperature.
@@ -64,7 +74,10 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    return _htu31d->getEvent(nullptr, tempEvent);
+    if (!readSnapshot())
+      return false;
+    tempEvent->temperature = _temp.temperature;
+    return true;
   }
 
   /*******************************************************************************/
@@ -77,11 +90,16 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    return _htu31d->getEvent(humidEvent, nullptr);
+    if (!readSnapshot())
+      return false;
+    humidEvent->relative_humidity = _humidity.relative_humidity;
+    return true;
   }
 
 protected:
-  Adafruit_HTU31D *_htu31d; ///< Pointer to an HTU31D object
+  Adafruit_HTU31D *_htu31d;  ///< Pointer to an HTU31D object
+  sensors_event_t _temp;     ///< Holds data for the HTU31D's temperature sensor
+  sensors_event_t _humidity; ///< Holds data for the HTU31D's humidity sensor
 };
 
 #endif // WipperSnapper_I2C_Driver_HTU31D
\ No newline at end of file
@@ -69,6 +69,17 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Takes a one-shot temperature and pressure measurement.
+      @returns  True, the LPS3XHW does not report measurement errors.
+  */
+  /*******************************************************************************/
+  bool readAll() {
+    _lps3xhw->takeMeasurement();
+    return true;
+  }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the LPS3XHW's current temperature.
@@ -79,7 +90,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    _lps3xhw->takeMeasurement();
+    readSnapshot();
     tempEvent->temperature = _lps3xhw->readTemperature();
     return true;
   }
@@ -95,7 +106,7 @@ public:
   */
   /*******************************************************************************/
   bool getEventPressure(sensors_event_t *pressureEvent) {
-    _lps3xhw->takeMeasurement();
+    readSnapshot();
     pressureEvent->pressure = _lps3xhw->readPressure();
     return true;
   }
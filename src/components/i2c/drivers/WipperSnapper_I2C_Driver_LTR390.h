@@ -18,6 +18,8 @@
 #include "WipperSnapper_I2C_Driver.h"
 #include <Adafruit_LTR390.h>
 
+#define LTR390_MEASUREMENT_MS 110 ///< Time to measure after a mode change
+
 /**************************************************************************/
 /*!
     @brief  Class that provides a driver interface for a LTR390 sensor.
@@ -68,6 +70,73 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Switches the LTR390 into the mode of the next reading to take.
+  */
+  /*******************************************************************************/
+  void setNextMode() {
+    ltr390_mode_t mode = _readALS ? LTR390_MODE_ALS : LTR390_MODE_UVS;
+    if (_ltr390->getMode() != mode) {
+      _ltr390->setMode(mode);
+      // discard the data ready flag left by the previous mode
+      _ltr390->newDataAvailable();
+    }
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Starts measuring each configured channel, ambient light first
+                and then UV, as the LTR390 only measures one at a time.
+      @returns  True if a measurement was started, False if neither channel
+                is configured.
+  */
+  /*******************************************************************************/
+  bool startConversion() {
+    _readALS = _lightSensorPeriod != 0;
+    _readUVS = _rawSensorPeriod != 0;
+    _als = NAN;
+    _uvs = NAN;
+    if (!_readALS && !_readUVS)
+      return false;
+    setNextMode();
+    return true;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Collects the current mode's reading once available, then
+                moves on to the next configured mode.
+      @returns  True once every configured channel has been read, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  bool conversionReady() {
+    if (!_ltr390->newDataAvailable())
+      return false;
+
+    if (_readALS) {
+      _als = _ltr390->readALS();
+      _readALS = false;
+      if (_readUVS) {
+        setNextMode();
+        return false;
+      }
+      return true;
+    }
+    _uvs = (float)_ltr390->readUVS();
+    _readUVS = false;
+    return true;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the time the LTR390 takes to measure in a single mode.
+      @returns  Measurement time, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return LTR390_MEASUREMENT_MS; }
+
   /*******************************************************************************/
   /*!
       @brief    Performs a light sensor read using the Adafruit
@@ -79,15 +148,10 @@ public:
   */
   /*******************************************************************************/
   bool getEventLight(sensors_event_t *lightEvent) {
-    if (_ltr390->getMode() != LTR390_MODE_ALS) {
-      _ltr390->setMode(LTR390_MODE_ALS);
-      delay(110);
-    }
-
-    if (!_ltr390->newDataAvailable())
+    if (isnan(_als))
       return false;
 
-    lightEvent->light = _ltr390->readALS();
+    lightEvent->light = _als;
     return true;
   }
 
@@ -101,20 +165,19 @@ public:
   */
   /*******************************************************************************/
   bool getEventRaw(sensors_event_t *rawEvent) {
-    if (_ltr390->getMode() != LTR390_MODE_UVS) {
-      _ltr390->setMode(LTR390_MODE_UVS);
-      delay(110);
-    }
-
-    if (!_ltr390->newDataAvailable())
+    if (isnan(_uvs))
       return false;
 
-    rawEvent->data[0] = (float)_ltr390->readUVS();
+    rawEvent->data[0] = _uvs;
     return true;
   }
 
 protected:
   Adafruit_LTR390 *_ltr390; ///< Pointer to LTR390 light sensor object
+  bool _readALS = false;    ///< True if ambient light is still to be read
+  bool _readUVS = false;    ///< True if UV is still to be read
+  float _als = NAN;         ///< Last ambient light reading
+  float _uvs = NAN;         ///< Last UV reading
 };
 
 #endif // WipperSnapper_I2C_Driver_LTR390
\ No newline at end of file
@@ -19,6 +19,8 @@
 #include "Wippersnapper.h"
 #include <Adafruit_MCP3421.h>
 
+#define MCP3421_CONVERSION_MS 267 ///< 18-bit conversion time, at 3.75 SPS
+
 /**************************************************************************/
 /*!
     @brief  Class that provides a driver interface for a MCP3421 sensor.
@@ -99,7 +101,37 @@ public:
 
   /*******************************************************************************/
   /*!
-      @brief    Reads the ADC sensor with short wait for data.
+      @brief    Starts a one-shot conversion.
+      @returns  True if the conversion was started, False otherwise.
+  */
+  /*******************************************************************************/
+  bool startConversion() {
+    if (!_mcp3421->startOneShotConversion()) {
+      WS_DEBUG_PRINTLN("Failed to start one-shot conversion");
+      return false;
+    }
+    return true;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Checks if the one-shot conversion has completed.
+      @returns  True if the conversion has completed, False otherwise.
+  */
+  /*******************************************************************************/
+  bool conversionReady() { return _mcp3421->isReady(); }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the time an 18-bit conversion takes.
+      @returns  Conversion time at 3.75 SPS, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return MCP3421_CONVERSION_MS; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Reads the result of the one-shot conversion.
       @param    rawEvent
                 ADC sensor reading
       @returns  True if the sensor event was obtained successfully, False
@@ -107,21 +139,6 @@ public:
   */
   /*******************************************************************************/
   bool getEventRaw(sensors_event_t *rawEvent) {
-    ulong start = millis();
-    if (!_mcp3421->startOneShotConversion()) {
-      WS_DEBUG_PRINTLN("Failed to start one-shot conversion");
-      return false;
-    }
-    while (!_mcp3421->isReady()) {
-      ulong newMillis = millis();
-      if (newMillis - start > 500) {
-        WS_DEBUG_PRINTLN("Timeout waiting for conversion to complete");
-        return false;
-      } else if (start > newMillis) {
-        start = millis(); // rollover
-      }
-      delay(50);
-    }
     rawEvent->data[0] = (float)_mcp3421->readADC();
     return true;
   }
@@ -130,4 +147,4 @@ protected:
   Adafruit_MCP3421 *_mcp3421; ///< Pointer to MCP3421 sensor object
 };
 
-#endif // WipperSnapper_I2C_Driver_MCP3421
\ No newline at end of file
+#endif // WipperSnapper_I2C_Driver_MCP3421
\ No newline at end of file
@@ -19,7 +19,7 @@
 #include "WipperSnapper_I2C_Driver.h"
 #include <Adafruit_NAU7802.h>
 
-#define NAU7802_TIMEOUT_MS 250 ///< Timeout waiting for data from NAU7802
+#define NAU7802_CONVERSION_MS 100 ///< Time between conversions at 10 SPS
 
 /**************************************************************************/
 /*!
@@ -112,6 +112,22 @@ public:
     }
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the time between the NAU7802's continuous conversions.
+      @returns  Conversion time at 10 samples per second, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return NAU7802_CONVERSION_MS; }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Checks if the NAU7802 has a new conversion available.
+      @returns  True if a reading is available, False otherwise.
+  */
+  /*******************************************************************************/
+  bool conversionReady() { return _nau7802->available(); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the sensor's raw "force" value.
@@ -121,14 +137,9 @@ public:
   */
   /*******************************************************************************/
   bool getEventRaw(sensors_event_t *rawEvent) {
-    unsigned long start = millis();
-
-    // Wait for the sensor to be ready
-    while (!_nau7802->available()) {
-      if (millis() - start > NAU7802_TIMEOUT_MS) {
-        WS_DEBUG_PRINTLN("NAU7802 data not available");
-        return false;
-      }
+    if (!_nau7802->available()) {
+      WS_DEBUG_PRINTLN("NAU7802 data not available");
+      return false;
     }
     rawEvent->data[0] = (float)_nau7802->read();
     return true;
@@ -138,4 +149,4 @@ protected:
   Adafruit_NAU7802 *_nau7802 = nullptr; ///< NAU7802 object
 };
 
-#endif // WipperSnapper_I2C_Driver_NAU7802_H
\ No newline at end of file
+#endif // WipperSnapper_I2C_Driver_NAU7802_H
\ No newline at end of file
@@ -61,6 +61,14 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads a full data frame from the PM25 sensor.
+      @returns  True if the frame was read successfully, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _pm25->read(&_data); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the PM25 sensor's PM1.0 STD reading.
@@ -71,11 +79,10 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM10_STD(sensors_event_t *pm10StdEvent) {
-    PM25_AQI_Data data;
-    if (!_pm25->read(&data))
+    if (!readSnapshot())
       return false; // couldn't read data
 
-    pm10StdEvent->pm10_std = (float)data.pm10_standard;
+    pm10StdEvent->pm10_std = (float)_data.pm10_standard;
     return true;
   }
 
@@ -89,11 +96,10 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM25_STD(sensors_event_t *pm25StdEvent) {
-    PM25_AQI_Data data;
-    if (!_pm25->read(&data))
+    if (!readSnapshot())
       return false; // couldn't read data
 
-    pm25StdEvent->pm25_std = (float)data.pm25_standard;
+    pm25StdEvent->pm25_std = (float)_data.pm25_standard;
     return true;
   }
 
@@ -107,16 +113,16 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM100_STD(sensors_event_t *pm100StdEvent) {
-    PM25_AQI_Data data;
-    if (!_pm25->read(&data))
+    if (!readSnapshot())
       return false; // couldn't read data
 
-    pm100StdEvent->pm100_std = (float)data.pm100_standard;
+    pm100StdEvent->pm100_std = (float)_data.pm100_standard;
     return true;
   }
 
 protected:
   Adafruit_PM25AQI *_pm25; ///< PM25 driver object
+  PM25_AQI_Data _data;     ///< Last data frame read from the sensor
 };
 
 #endif // WipperSnapper_I2C_Driver_PM25
\ No newline at end of file
@@ -19,6 +19,8 @@
 #include "WipperSnapper_I2C_Driver.h"
 #include <Adafruit_SCD30.h>
 
+#define SCD30_MEASUREMENT_INTERVAL_MS 2000 ///< Default measurement interval
+
 /**************************************************************************/
 /*!
     @brief  Class that provides a driver interface for the SCD30 sensor.
@@ -55,51 +57,32 @@ public:
 
   /*******************************************************************************/
   /*!
-      @brief    Checks if sensor was read within last 1s, or is the first read.
-      @returns  True if the sensor was recently read, False otherwise.
+      @brief    Gets the time between the SCD30's continuous measurements.
+      @returns  Measurement interval, in milliseconds.
   */
-  bool alreadyRecentlyRead() {
-    return (_lastRead != 0 && millis() - _lastRead) < 1000;
-  }
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return SCD30_MEASUREMENT_INTERVAL_MS; }
 
   /*******************************************************************************/
   /*!
-      @brief    Checks if the sensor is ready to be read
+      @brief    Checks if the SCD30 has a new measurement available.
       @returns  True if the sensor is ready, False otherwise.
   */
   /*******************************************************************************/
-  bool sensorReady() {
-    if (!_scd->dataReady()) {
-      // failed, one more quick attempt
-      delay(100);
-      if (!_scd->dataReady()) {
-        return false;
-      }
-    }
-    return true;
-  }
+  bool conversionReady() { return _scd->dataReady(); }
 
   /*******************************************************************************/
   /*!
-      @brief    Reads the SCD30 sensor.
+      @brief    Reads temperature, humidity and CO2 from the SCD30 in a single
+                transaction.
       @returns  True if the sensor was read successfully, False otherwise.
   */
   /*******************************************************************************/
-  bool readSensorData() {
-    // dont read sensor more than once per second
-    if (alreadyRecentlyRead()) {
-      return true;
-    }
-
-    if (!sensorReady()) {
-      return false;
-    }
-
-    if (_scd->getEvent(&_humidity, &_temperature)) {
+  bool readAll() {
+    if (!_scd->getEvent(&_humidity, &_temperature)) {
       return false;
     }
     _CO2.CO2 = _scd->CO2;
-    _lastRead = millis();
     return true;
   }
 
@@ -114,11 +97,11 @@ public:
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
     // check if sensor is enabled and data is available
-    if (!readSensorData()) {
+    if (!readSnapshot()) {
       return false;
     }
 
-    tempEvent = &_temperature;
+    tempEvent->temperature = _temperature.temperature;
     return true;
   }
 
@@ -133,11 +116,11 @@ public:
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
     // check if sensor is enabled and data is available
-    if (!readSensorData()) {
+    if (!readSnapshot()) {
       return false;
     }
 
-    humidEvent = &_humidity;
+    humidEvent->relative_humidity = _humidity.relative_humidity;
     return true;
   }
 
@@ -152,17 +135,16 @@ public:
   /*******************************************************************************/
   bool getEventCO2(sensors_event_t *co2Event) {
     // check if sensor is enabled and data is available
-    if (!readSensorData()) {
+    if (!readSnapshot()) {
       return false;
     }
 
-    co2Event = &_CO2;
+    co2Event->CO2 = _CO2.CO2;
     return true;
   }
 
 protected:
   Adafruit_SCD30 *_scd = nullptr; ///< SCD30 driver object
-  ulong _lastRead = 0;            ///< Last time the sensor was read
   sensors_event_t _temperature;   ///< Temperature
   sensors_event_t _humidity;      ///< Relative Humidity
   sensors_event_t _CO2;           ///< CO2
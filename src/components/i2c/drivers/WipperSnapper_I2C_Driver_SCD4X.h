@@ -72,7 +72,7 @@ public:
                 if read errors occured or if sensor did not have data ready.
   */
   /********************************************************************************/
-  bool readSensorMeasurements() {
+  bool readAll() {
     uint16_t error;
     bool isDataReady = false;
     delay(100);
@@ -100,8 +100,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    // read all sensor measurements
-    if (!readSensorMeasurements())
+    // read all sensor measurements, once per poll
+    if (!readSnapshot())
       return false;
 
     tempEvent->temperature = _temperature;
@@ -118,8 +118,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    // read all sensor measurements
-    if (!readSensorMeasurements())
+    // read all sensor measurements, once per poll
+    if (!readSnapshot())
       return false;
 
     humidEvent->relative_humidity = _humidity;
@@ -136,8 +136,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventCO2(sensors_event_t *co2Event) {
-    // read all sensor measurements
-    if (!readSensorMeasurements())
+    // read all sensor measurements, once per poll
+    if (!readSnapshot())
       return false;
 
     co2Event->CO2 = (float)_co2;
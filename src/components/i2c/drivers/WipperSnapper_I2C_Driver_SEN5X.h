@@ -69,6 +69,21 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads every SEN5X measurement in a single transaction.
+      @returns  True if the measurements were read successfully, False
+                otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() {
+    uint16_t error = _sen->readMeasuredValues(
+        _massConcentrationPm1p0, _massConcentrationPm2p5,
+        _massConcentrationPm4p0, _massConcentrationPm10p0, _ambientHumidity,
+        _ambientTemperature, _vocIndex, _noxIndex);
+    return error == 0;
+  }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the SEN5X's current temperature.
@@ -79,20 +94,11 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_tempSensorPeriod != 0 && error != 0) || ambientTemperature == NAN) {
+    if (!readSnapshot() || _ambientTemperature == NAN) {
       return false;
     }
 
-    tempEvent->temperature = ambientTemperature;
+    tempEvent->temperature = _ambientTemperature;
     return true;
   }
 
@@ -106,20 +112,11 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_humidSensorPeriod != 0 && error != 0) || ambientHumidity == NAN) {
+    if (!readSnapshot() || _ambientHumidity == NAN) {
       return false;
     }
 
-    humidEvent->relative_humidity = ambientHumidity;
+    humidEvent->relative_humidity = _ambientHumidity;
     return true;
   }
 
@@ -136,20 +133,11 @@ public:
   */
   /*******************************************************************************/
   bool getEventNOxIndex(sensors_event_t *noxIndexEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_NOxIndexPeriod != 0 && error != 0) || noxIndex == NAN) {
+    if (!readSnapshot() || _noxIndex == NAN) {
       return false;
     }
 
-    noxIndexEvent->nox_index = noxIndex;
+    noxIndexEvent->nox_index = _noxIndex;
     return true;
   }
 
@@ -163,20 +151,11 @@ public:
   */
   /*******************************************************************************/
   bool getEventVOCIndex(sensors_event_t *vocIndexEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_VOCIndexPeriod != 0 && error != 0) || vocIndex == NAN) {
+    if (!readSnapshot() || _vocIndex == NAN) {
       return false;
     }
 
-    vocIndexEvent->voc_index = vocIndex;
+    vocIndexEvent->voc_index = _vocIndex;
     return true;
   }
 
@@ -190,22 +169,12 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM10_STD(sensors_event_t *pm10StdEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_PM10SensorPeriod != 0 && error != 0) ||
-        massConcentrationPm1p0 == NAN ||
-        massConcentrationPm1p0 == OVERFLOW_SEN55) {
+    if (!readSnapshot() || _massConcentrationPm1p0 == NAN ||
+        _massConcentrationPm1p0 == OVERFLOW_SEN55) {
       return false;
     }
 
-    pm10StdEvent->pm10_std = massConcentrationPm1p0;
+    pm10StdEvent->pm10_std = _massConcentrationPm1p0;
     return true;
   }
 
@@ -219,22 +188,12 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM25_STD(sensors_event_t *pm25StdEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_PM25SensorPeriod != 0 && error != 0) ||
-        massConcentrationPm2p5 == NAN ||
-        massConcentrationPm2p5 == OVERFLOW_SEN55) {
+    if (!readSnapshot() || _massConcentrationPm2p5 == NAN ||
+        _massConcentrationPm2p5 == OVERFLOW_SEN55) {
       return false;
     }
 
-    pm25StdEvent->pm25_std = massConcentrationPm2p5;
+    pm25StdEvent->pm25_std = _massConcentrationPm2p5;
     return true;
   }
 
@@ -248,22 +207,12 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM40_STD(sensors_event_t *pm40StdEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_PM25SensorPeriod != 0 && error != 0) ||
-        massConcentrationPm4p0 == NAN ||
-        massConcentrationPm4p0 == OVERFLOW_SEN55) {
+    if (!readSnapshot() || _massConcentrationPm4p0 == NAN ||
+        _massConcentrationPm4p0 == OVERFLOW_SEN55) {
       return false;
     }
 
-    pm40StdEvent->data[0] = massConcentrationPm4p0;
+    pm40StdEvent->data[0] = _massConcentrationPm4p0;
     return true;
   }
 
@@ -277,27 +226,25 @@ public:
   */
   /*******************************************************************************/
   bool getEventPM100_STD(sensors_event_t *pm100StdEvent) {
-    float massConcentrationPm1p0, massConcentrationPm2p5,
-        massConcentrationPm4p0, massConcentrationPm10p0, ambientHumidity,
-        ambientTemperature, vocIndex, noxIndex;
-    uint16_t error;
-
-    error = _sen->readMeasuredValues(
-        massConcentrationPm1p0, massConcentrationPm2p5, massConcentrationPm4p0,
-        massConcentrationPm10p0, ambientHumidity, ambientTemperature, vocIndex,
-        noxIndex);
-    if ((_PM100SensorPeriod != 0 && error != 0) ||
-        massConcentrationPm10p0 == NAN ||
-        massConcentrationPm10p0 == OVERFLOW_SEN55) {
+    if (!readSnapshot() || _massConcentrationPm10p0 == NAN ||
+        _massConcentrationPm10p0 == OVERFLOW_SEN55) {
       return false;
     }
 
-    pm100StdEvent->pm100_std = massConcentrationPm10p0;
+    pm100StdEvent->pm100_std = _massConcentrationPm10p0;
     return true;
   }
 
 protected:
-  SensirionI2CSen5x *_sen; ///< SEN5X driver object
+  SensirionI2CSen5x *_sen;        ///< SEN5X driver object
+  float _massConcentrationPm1p0;  ///< PM1.0 mass concentration, in ug/m3
+  float _massConcentrationPm2p5;  ///< PM2.5 mass concentration, in ug/m3
+  float _massConcentrationPm4p0;  ///< PM4.0 mass concentration, in ug/m3
+  float _massConcentrationPm10p0; ///< PM10.0 mass concentration, in ug/m3
+  float _ambientHumidity;         ///< Relative humidity, in %RH
+  float _ambientTemperature;      ///< Temperature, in degrees C
+  float _vocIndex;                ///< VOC index
+  float _noxIndex;                ///< NOx index
 };
 
 #endif // WipperSnapper_I2C_Driver_SEN5X
@@ -64,6 +64,14 @@ public:
     return _sht3x->setAccuracy(SHTSensor::SHT_ACCURACY_HIGH);
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads a temperature and humidity sample from the SHT3X.
+      @returns  True if the sample was read successfully, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _sht3x->readSample(); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the SHT3X's current temperature.
@@ -74,8 +82,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_sht3x->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     tempEvent->temperature = _sht3x->getTemperature();
     return true;
@@ -91,8 +99,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_sht3x->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     humidEvent->relative_humidity = _sht3x->getHumidity();
     return true;
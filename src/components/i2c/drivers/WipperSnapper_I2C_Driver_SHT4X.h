@@ -62,6 +62,14 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads a temperature and humidity sample from the SHT4X.
+      @returns  True if the sample was read successfully, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _sht4x->readSample(); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the SHT4X's current temperature.
@@ -72,8 +80,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_sht4x->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     tempEvent->temperature = _sht4x->getTemperature();
     return true;
@@ -89,8 +97,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_sht4x->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     humidEvent->relative_humidity = _sht4x->getHumidity();
     return true;
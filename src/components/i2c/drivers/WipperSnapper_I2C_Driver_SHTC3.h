@@ -56,6 +56,14 @@ public:
     return _shtc3->init(*_i2c);
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Reads a temperature and humidity sample from the SHTC3.
+      @returns  True if the sample was read successfully, False otherwise.
+  */
+  /*******************************************************************************/
+  bool readAll() { return _shtc3->readSample(); }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the SHTC3's current temperature.
@@ -66,8 +74,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventAmbientTemp(sensors_event_t *tempEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_shtc3->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     tempEvent->temperature = _shtc3->getTemperature();
     return true;
@@ -83,8 +91,8 @@ public:
   */
   /*******************************************************************************/
   bool getEventRelativeHumidity(sensors_event_t *humidEvent) {
-    // populate temp and humidity objects with fresh data
-    if (!_shtc3->readSample())
+    // use the sample taken for this poll
+    if (!readSnapshot())
       return false;
     humidEvent->relative_humidity = _shtc3->getHumidity();
     return true;
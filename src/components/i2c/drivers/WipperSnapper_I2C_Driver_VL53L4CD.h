@@ -18,6 +18,8 @@
 #include "WipperSnapper_I2C_Driver.h"
 #include <vl53l4cd_class.h>
 
+#define VL53L4CD_RANGING_MS 250 ///< 200ms timing budget, plus margin
+
 /**************************************************************************/
 /*!
     @brief  Class that provides a driver interface for a VL53L4CD sensor.
@@ -101,6 +103,42 @@ public:
     return true;
   }
 
+  /*******************************************************************************/
+  /*!
+      @brief    Starts a fresh ranging measurement.
+      @returns  True if the measurement was started, False otherwise.
+  */
+  /*******************************************************************************/
+  bool startConversion() {
+    // Start fresh reading, seemed to be accepting stale value
+    return _VL53L4CD->VL53L4CD_ClearInterrupt() == VL53L4CD_ERROR_NONE;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Checks if the VL53L4CD has a ranging result available.
+      @returns  True if a result is ready, False otherwise.
+  */
+  /*******************************************************************************/
+  bool conversionReady() {
+    uint8_t NewDataReady = 0;
+    uint8_t status = _VL53L4CD->VL53L4CD_CheckForDataReady(&NewDataReady);
+    if (status == VL53L4CD_ERROR_INVALID_ARGUMENT) {
+      WS_DEBUG_PRINTLN("VL53L4CD: Invalid argument to CheckForDataReady()");
+    } else if (status == VL53L4CD_ERROR_TIMEOUT) {
+      WS_DEBUG_PRINTLN("VL53L4CD: Timeout waiting for data ready");
+    }
+    return (status == VL53L4CD_ERROR_NONE) && (NewDataReady != 0);
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief    Gets the time a ranging measurement takes.
+      @returns  Timing budget plus margin, in milliseconds.
+  */
+  /*******************************************************************************/
+  unsigned long getConversionTime() { return VL53L4CD_RANGING_MS; }
+
   /*******************************************************************************/
   /*!
       @brief    Gets the VL53L4CD's current proximity.
@@ -111,49 +149,25 @@ public:
   */
   /*******************************************************************************/
   bool getEventProximity(sensors_event_t *proximityEvent) {
-    uint8_t NewDataReady = 0;
     VL53L4CD_Result_t results;
-    uint8_t status;
-    // Start fresh reading, seemed to be accepting stale value
+    // (Mandatory) Clear HW interrupt to restart measurements
     _VL53L4CD->VL53L4CD_ClearInterrupt();
-    WS_DEBUG_PRINT("Waiting for VL53L4CD data ready...");
-    delay(250);
-
-    for (uint8_t retries = 0;
-         (status = _VL53L4CD->VL53L4CD_CheckForDataReady(&NewDataReady)) &&
-         !NewDataReady && retries < 3;
-         retries++) {
-      delay(300);
-      WS_DEBUG_PRINT(" .");
+
+    // Read measured distance. RangeStatus = 0 means valid data
+    if (_VL53L4CD->VL53L4CD_GetResult(&results) != VL53L4CD_ERROR_NONE) {
+      WS_DEBUG_PRINTLN("VL53L4CD: Failed to get result");
+      return false;
     }
-    WS_DEBUG_PRINTLN();
-    if ((status == VL53L4CD_ERROR_NONE) && (NewDataReady != 0)) {
-      // (Mandatory) Clear HW interrupt to restart measurements
-      _VL53L4CD->VL53L4CD_ClearInterrupt();
-
-      // Read measured distance. RangeStatus = 0 means valid data
-      if (_VL53L4CD->VL53L4CD_GetResult(&results) == VL53L4CD_ERROR_NONE) {
-        if (results.range_status != 0) {
-          WS_DEBUG_PRINT("VL53L4CD range status: ");
-          WS_DEBUG_PRINTLN(results.range_status);
-          return false;
-        }
-        proximityEvent->data[0] = (float)results.distance_mm;
-        return true;
-      }
-      // NOTE: Once I2C sensors fire all data points during a single call, we
-      // can return the std deviation in MM for the measurements. See
-      // https://github.com/stm32duino/VL53L4CD/blob/066664f983bcf70819133c7fcf43101035b09bab/src/vl53l4cd_api.h#L130-L131
-    } else {
-      if (status == VL53L4CD_ERROR_INVALID_ARGUMENT) {
-        WS_DEBUG_PRINTLN("VL53L4CD: Invalid argument to CheckForDataReady()");
-      } else if (status == VL53L4CD_ERROR_TIMEOUT) {
-        WS_DEBUG_PRINTLN("VL53L4CD: Timeout waiting for data ready");
-      } else {
-        WS_DEBUG_PRINTLN("VL53L4CD: data not ready yet");
-      }
+    if (results.range_status != 0) {
+      WS_DEBUG_PRINT("VL53L4CD range status: ");
+      WS_DEBUG_PRINTLN(results.range_status);
+      return false;
     }
-    return false;
+    proximityEvent->data[0] = (float)results.distance_mm;
+    // NOTE: Once I2C sensors fire all data points during a single call, we
+    // can return the std deviation in MM for the measurements. See
+    // https://github.com/stm32duino/VL53L4CD/blob/066664f983bcf70819133c7fcf43101035b09bab/src/vl53l4cd_api.h#L130-L131
+    return true;
   }
 
 protected:
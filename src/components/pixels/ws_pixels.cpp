@@ -27,6 +27,13 @@ strand_s strands[MAX_PIXEL_STRANDS]{
     -1,
     -1}; ///< Contains all pixel strands used by WipperSnapper
 
+/**************************************************************************/
+/*!
+    @brief  Constructor
+*/
+/**************************************************************************/
+ws_pixels::ws_pixels() {}
+
 /**************************************************************************/
 /*!
     @brief  Destructor
@@ -167,24 +174,20 @@ void ws_pixels::publishAddStrandResponse(bool is_success,
          pixels_pin_data, sizeof(char) * 6);
 
   // Encode `wippersnapper_pixels_v1_PixelsCreateResponse` message
-  memset(WS._buffer_outgoing, 0, sizeof(WS._buffer_outgoing));
-  pb_ostream_t ostream =
-      pb_ostream_from_buffer(WS._buffer_outgoing, sizeof(WS._buffer_outgoing));
-  if (!ws_pb_encode(&ostream, wippersnapper_signal_v1_PixelsResponse_fields,
-                    &msgInitResp)) {
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_PixelsResponse_fields, &msgInitResp);
+  if (msgSz == 0) {
     WS_DEBUG_PRINTLN("ERROR: Unable to encode "
                      "wippersnapper_signal_v1_PixelsResponse message!");
     return;
   }
 
   // Publish message to broker
-  size_t msgSz;
-  pb_get_encoded_size(&msgSz, wippersnapper_signal_v1_PixelsResponse_fields,
-                      &msgInitResp);
   WS_DEBUG_PRINT("-> wippersnapper_signal_v1_PixelsResponse...");
-  WS._mqtt->publish(WS._topic_signal_pixels_device, WS._buffer_outgoing, msgSz,
-                    1);
-  WS_DEBUG_PRINTLN("Published!");
+  WS._publishQueue->enqueue(WS._topic_signal_pixels_device,
+                            WS._buffer_outgoing, msgSz, 1);
+  WS_DEBUG_PRINTLN("Queued!");
 }
 
 /**************************************************************************/
@@ -431,6 +434,10 @@ void ws_pixels::fillStrand(
   WS_DEBUG_PRINT("Filling color: ");
   WS_DEBUG_PRINTLN(pixelsWriteMsg->pixels_color);
 
+  // A solid color replaces any animation on the strand
+  strands[strandIdx].effect.type =
+      wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED;
+
 #ifdef USE_DISPLAY
   char buffer[100];
   snprintf(buffer, 100, "[Pixel] Filling strand on pin %s with color %u\n",
@@ -450,4 +457,213 @@ void ws_pixels::fillStrand(
   } else {
     WS_DEBUG_PRINTLN("ERROR: Unable to determine pixel type to write to!");
   }
-}
\ No newline at end of file
+}
+/**************************************************************************/
+/*!
+    @brief   Starts an animation on a strand of addressable pixels. Frames
+             are rendered by update(), so the effect's parameters are only
+             sent once.
+    @param   pixelsAnimateMsg
+             Protobuf message from Adafruit IO containing a
+             `wippersnapper_pixels_v1_PixelsAnimateRequest`.
+*/
+/**************************************************************************/
+void ws_pixels::animateStrand(
+    wippersnapper_pixels_v1_PixelsAnimateRequest *pixelsAnimateMsg) {
+  // Get index of pixel strand
+  int strandIdx = getStrandIdx(atoi(pixelsAnimateMsg->pixels_pin_data + 1),
+                               pixelsAnimateMsg->pixels_type);
+  if (strandIdx == ERR_INVALID_STRAND ||
+      strands[strandIdx].type ==
+          wippersnapper_pixels_v1_PixelsType_PIXELS_TYPE_UNSPECIFIED) {
+    WS_DEBUG_PRINTLN("ERROR: Pixel strand not found, can not animate the "
+                     "strand!");
+    return;
+  }
+
+  pixels_effect_s &effect = strands[strandIdx].effect;
+  effect.type = pixelsAnimateMsg->pixels_effect;
+  effect.color = pixelsAnimateMsg->pixels_color;
+  effect.colorSecondary = pixelsAnimateMsg->pixels_color_secondary;
+  effect.periodMs = pixelsAnimateMsg->pixels_period_ms;
+  effect.width = pixelsAnimateMsg->pixels_width == 0
+                     ? 1
+                     : (uint16_t)min(pixelsAnimateMsg->pixels_width,
+                                     (uint32_t)strands[strandIdx].numPixels);
+  effect.start = millis();
+  effect.nextFrame = effect.start;
+
+  WS_DEBUG_PRINT("Animating strand with effect: ");
+  WS_DEBUG_PRINTLN(effect.type);
+
+#ifdef USE_DISPLAY
+  char buffer[100];
+  snprintf(buffer, 100, "[Pixel] Animating strand on pin %s with effect %d\n",
+           pixelsAnimateMsg->pixels_pin_data, (int)effect.type);
+  WS._ui_helper->add_text_to_terminal(buffer);
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief   Renders the next frame of each animated strand whose frame is
+             due. Frames missed while the loop was busy are dropped, as
+             effects are timed from their start rather than by frame count.
+*/
+/**************************************************************************/
+void ws_pixels::update() {
+  unsigned long curTime = millis();
+  for (strand_s &strand : strands) {
+    pixels_effect_s &effect = strand.effect;
+    if (effect.type ==
+            wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED ||
+        (long)(curTime - effect.nextFrame) < 0)
+      continue;
+
+    if (!renderFrame(strand, curTime)) {
+      // Last frame of the effect was rendered, leave it on the strand
+      effect.type =
+          wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED;
+      continue;
+    }
+    effect.nextFrame += WS_PIXELS_FRAME_MS;
+    if ((long)(curTime - effect.nextFrame) >= 0)
+      effect.nextFrame = curTime + WS_PIXELS_FRAME_MS;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Finds when update() next has a frame to render.
+    @param   curTime
+             Current time, from millis().
+    @returns Deadline as a millis() timestamp.
+*/
+/**************************************************************************/
+unsigned long ws_pixels::getNextUpdateTime(unsigned long curTime) {
+  unsigned long nextTime = curTime + WS_SCHEDULER_IDLE_MS;
+  for (strand_s &strand : strands) {
+    if (strand.effect.type !=
+        wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED)
+      nextTime = ws_scheduler::earliest(nextTime, strand.effect.nextFrame);
+  }
+  return nextTime;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Renders and shows one frame of a strand's effect.
+    @param   strand
+             Animated strand.
+    @param   curTime
+             Current time, from millis().
+    @returns True if the effect has more frames, False if this was its
+             last frame.
+*/
+/**************************************************************************/
+bool ws_pixels::renderFrame(strand_s &strand, unsigned long curTime) {
+  const pixels_effect_s &effect = strand.effect;
+  unsigned long elapsed = curTime - effect.start;
+
+  // Position within the effect's cycle, from 0 to 65535. A fade runs once,
+  // the other effects repeat. Without a period, one frame is shown.
+  uint16_t phase = 0;
+  bool hasMoreFrames = effect.periodMs > 0;
+  if (effect.type == wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_FADE) {
+    hasMoreFrames = elapsed < effect.periodMs;
+    phase = hasMoreFrames
+                ? (uint16_t)(((uint64_t)elapsed * 65535) / effect.periodMs)
+                : 65535;
+  } else if (effect.periodMs > 0) {
+    phase = (uint16_t)(((uint64_t)(elapsed % effect.periodMs) << 16) /
+                       effect.periodMs);
+  }
+
+  for (uint16_t i = 0; i < strand.numPixels; i++) {
+    uint32_t color = getEffectColor(effect, i, strand.numPixels, phase);
+    if (strand.neoPixelPtr != nullptr)
+      strand.neoPixelPtr->setPixelColor(i, strand.neoPixelPtr->gamma32(color));
+    else if (strand.dotStarPtr != nullptr)
+      strand.dotStarPtr->setPixelColor(i, strand.dotStarPtr->gamma32(color));
+  }
+
+  if (strand.neoPixelPtr != nullptr) {
+    strand.neoPixelPtr->show();
+  } else if (strand.dotStarPtr != nullptr) {
+    strand.dotStarPtr->show();
+  } else {
+    WS_DEBUG_PRINTLN("ERROR: Unable to determine pixel type to animate!");
+    return false;
+  }
+  return hasMoreFrames;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Computes the color of one pixel in a frame of an effect.
+    @param   effect
+             Effect being rendered.
+    @param   pixel
+             Index of the pixel on the strand.
+    @param   numPixels
+             Number of pixels on the strand.
+    @param   phase
+             Position within the effect's cycle, from 0 to 65535.
+    @returns The pixel's color, before gamma correction.
+*/
+/**************************************************************************/
+uint32_t ws_pixels::getEffectColor(const pixels_effect_s &effect,
+                                   uint16_t pixel, uint16_t numPixels,
+                                   uint16_t phase) {
+  switch (effect.type) {
+  case wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_FADE:
+    // From the primary to the secondary color
+    return blendColor(effect.color, effect.colorSecondary, phase >> 8);
+  case wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_CHASE: {
+    // A run of primary pixels travelling over the secondary color
+    uint16_t head = (uint16_t)(((uint32_t)phase * numPixels) >> 16);
+    uint16_t offset = (uint16_t)((pixel + numPixels - head) % numPixels);
+    return offset < effect.width ? effect.color : effect.colorSecondary;
+  }
+  case wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_RAINBOW:
+    // One turn of the color wheel along the strand, rotating
+    return Adafruit_NeoPixel::ColorHSV(
+        (uint16_t)(phase + ((uint32_t)pixel << 16) / numPixels));
+  case wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_BREATHE:
+    // Between the secondary and primary colors along a sine wave, starting
+    // from the secondary color
+    return blendColor(effect.colorSecondary, effect.color,
+                      Adafruit_NeoPixel::sine8((uint8_t)((phase >> 8) + 192)));
+  case wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_GRADIENT: {
+    // Primary to secondary and back along the strand, scrolling
+    uint16_t pos = (uint16_t)(phase + ((uint32_t)pixel << 16) / numPixels);
+    uint8_t frac = pos < 32768 ? (uint8_t)(pos >> 7)
+                               : (uint8_t)((65535 - pos) >> 7);
+    return blendColor(effect.color, effect.colorSecondary, frac);
+  }
+  default:
+    return 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Blends two packed colors, channel by channel.
+    @param   from
+             Color at frac 0.
+    @param   to
+             Color at frac 255.
+    @param   frac
+             Amount of `to` in the result, from 0 to 255.
+    @returns The blended color.
+*/
+/**************************************************************************/
+uint32_t ws_pixels::blendColor(uint32_t from, uint32_t to, uint8_t frac) {
+  uint32_t color = 0;
+  for (uint8_t shift = 0; shift < 32; shift += 8) {
+    int16_t a = (from >> shift) & 0xFF;
+    int16_t b = (to >> shift) & 0xFF;
+    color |= (uint32_t)(uint8_t)(a + (b - a) * frac / 255) << shift;
+  }
+  return color;
+}
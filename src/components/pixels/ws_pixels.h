@@ -25,6 +25,23 @@
 
 #define ERR_INVALID_STRAND -1 ///< Invalid strand index
 
+#ifndef WS_PIXELS_FRAME_MS
+#define WS_PIXELS_FRAME_MS                                                     \
+  20 ///< Time between animation frames, in milliseconds
+#endif
+
+/** Animation running on a strand of pixels */
+struct pixels_effect_s {
+  wippersnapper_pixels_v1_PixelsEffect
+      type;                ///< Effect, PIXELS_EFFECT_UNSPECIFIED if none
+  uint32_t color;          ///< Primary color
+  uint32_t colorSecondary; ///< Secondary color
+  uint32_t periodMs;       ///< Length of one cycle of the effect, in ms
+  uint16_t width;          ///< Number of lit pixels in a chase
+  unsigned long start;     ///< When the effect started, in millis
+  unsigned long nextFrame; ///< When the next frame is due, in millis
+};
+
 /** Object representation of a strand of pixels */
 struct strand_s {
   Adafruit_NeoPixel *neoPixelPtr; ///< Ptr to a NeoPixel object
@@ -37,6 +54,7 @@ struct strand_s {
   int16_t pinNeoPixel;                          ///< NeoPixel strand data pin
   int16_t pinDotStarData;                       ///< DotStar strand data pin
   int16_t pinDotStarClock;                      ///< DotStar strand clock pin
+  pixels_effect_s effect;                       ///< Animation on the strand
 };
 
 class Wippersnapper; ///< friend class
@@ -57,6 +75,12 @@ public:
   void
   deleteStrand(wippersnapper_pixels_v1_PixelsDeleteRequest *pixelsDeleteMsg);
   void fillStrand(wippersnapper_pixels_v1_PixelsWriteRequest *pixelsWriteMsg);
+  void
+  animateStrand(wippersnapper_pixels_v1_PixelsAnimateRequest *pixelsAnimateMsg);
+
+  // Animation
+  void update();
+  unsigned long getNextUpdateTime(unsigned long curTime);
 
   // Helpers
   int16_t allocateStrand();
@@ -67,6 +91,10 @@ public:
   uint8_t getDotStarStrandOrder(wippersnapper_pixels_v1_PixelsOrder pixelOrder);
   void publishAddStrandResponse(bool is_success, char *pixels_pin_data);
   uint32_t getGammaCorrectedColor(uint32_t pixel_color, strand_s strand);
+  bool renderFrame(strand_s &strand, unsigned long curTime);
+  uint32_t getEffectColor(const pixels_effect_s &effect, uint16_t pixel,
+                          uint16_t numPixels, uint16_t phase);
+  uint32_t blendColor(uint32_t from, uint32_t to, uint8_t frac);
 };
 extern Wippersnapper WS;
 #endif // WS_PIXELS
\ No newline at end of file
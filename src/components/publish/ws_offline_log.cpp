@@ -0,0 +1,464 @@
+/*!
+ * @file ws_offline_log.cpp
+ *
+ * Store-and-forward log for outbound MQTT messages.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_offline_log.h"
+#include "Wippersnapper.h"
+
+#ifdef WS_USE_OFFLINE_LOG
+#if defined(USE_TINYUSB)
+extern FatVolume wipperFatFs; ///< Defined in Wippersnapper_FS.cpp
+#endif
+
+/**************************************************************************/
+/*!
+    @brief    Writes any batched records and closes the log file.
+*/
+/**************************************************************************/
+ws_offline_log::~ws_offline_log() {
+  if (_ready)
+    commit();
+  closeFile();
+}
+
+/**************************************************************************/
+/*!
+    @brief    Opens the log file, resuming from the records it holds. A
+              missing or incompatible file is replaced by an empty log of
+              WS_OFFLINE_LOG_SIZE bytes, allocated up front so spooling
+              only ever overwrites the file in place.
+    @returns  True if the log is ready to use, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::begin() {
+  if (!openFile()) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to open the offline log!");
+    return false;
+  }
+  _ready = true;
+
+  ws_offline_log_hdr_t hdr;
+  if (readAt(0, &hdr, sizeof(hdr)) && hdr.magic == WS_OFFLINE_LOG_MAGIC &&
+      hdr.size == WS_OFFLINE_LOG_SIZE && hdr.head <= WS_OFFLINE_LOG_SIZE &&
+      hdr.tail <= WS_OFFLINE_LOG_SIZE) {
+    _head = hdr.head;
+    _tail = hdr.tail;
+    _count = hdr.count;
+    if (_count > 0) {
+      WS_DEBUG_PRINT("Offline log holds ");
+      WS_DEBUG_PRINT(_count);
+      WS_DEBUG_PRINTLN(" messages to replay");
+    }
+    return true;
+  }
+
+  WS_DEBUG_PRINTLN("Creating offline log...");
+  memset(_buf, 0, sizeof(_buf));
+  for (uint32_t pos = 0; pos < WS_OFFLINE_LOG_SIZE; pos += sizeof(_buf)) {
+    uint32_t len = WS_OFFLINE_LOG_SIZE - pos;
+    if (len > sizeof(_buf))
+      len = sizeof(_buf);
+    if (!writeAt(sizeof(hdr) + pos, _buf, len)) {
+      WS_DEBUG_PRINTLN("ERROR: Unable to allocate the offline log!");
+      _ready = false;
+      closeFile();
+      return false;
+    }
+    WS.feedWDT();
+  }
+  clear();
+  return commit();
+}
+
+/**************************************************************************/
+/*!
+    @brief    Adds a message to the end of the log, overwriting the oldest
+              messages if the log is full. The record is batched in RAM
+              until the batch fills or commit() is called.
+    @param    topic
+              MQTT topic the message is published to.
+    @param    payload
+              Encoded message.
+    @param    len
+              Length of payload, in bytes.
+    @param    qos
+              MQTT quality of service to publish with.
+    @returns  True if the message was added, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::append(const char *topic, const uint8_t *payload,
+                            uint16_t len, uint8_t qos) {
+  size_t topicLen = strlen(topic);
+  uint32_t size = sizeof(ws_offline_record_t) + topicLen + 1 + len;
+  if (!_ready || size > sizeof(_buf))
+    return false;
+
+  uint32_t pos;
+  while (!reserve(size, pos)) {
+    if (!dropOldest())
+      return false;
+  }
+
+  ws_offline_record_t rec = {};
+  rec.len = (uint16_t)(topicLen + 1 + len);
+  rec.topicLen = (uint16_t)topicLen;
+  rec.qos = qos;
+  _dirty = true;
+  if (!stage(pos, &rec, sizeof(rec)) ||
+      !stage(pos + sizeof(rec), topic, topicLen + 1) ||
+      !stage(pos + sizeof(rec) + topicLen + 1, payload, len)) {
+    // The ring no longer matches the file, start over
+    clear();
+    return false;
+  }
+  _count++;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reads the oldest message in the log without removing it. The
+              returned pointers are valid until the log is next modified.
+    @param    topic
+              MQTT topic the message is published to.
+    @param    payload
+              Encoded message.
+    @param    len
+              Length of payload, in bytes.
+    @param    qos
+              MQTT quality of service to publish with.
+    @returns  True if a message was read, False if the log is empty or
+              could not be read.
+*/
+/**************************************************************************/
+bool ws_offline_log::peek(const char *&topic, const uint8_t *&payload,
+                          uint16_t &len, uint8_t &qos) {
+  ws_offline_record_t rec;
+  if (!readHeader(rec))
+    return false;
+  if (!readAt(sizeof(ws_offline_log_hdr_t) + _head + sizeof(rec), _buf,
+              rec.len) ||
+      _buf[rec.topicLen] != '\0') {
+    WS_DEBUG_PRINTLN("ERROR: Offline log is corrupt, discarding it!");
+    clear();
+    return false;
+  }
+  topic = (const char *)_buf;
+  payload = &_buf[rec.topicLen + 1];
+  len = rec.len - rec.topicLen - 1;
+  qos = rec.qos;
+  _peekSize = sizeof(rec) + rec.len;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Removes the message returned by peek(). The removal is only
+              persisted by commit(), a message may be replayed twice if
+              the device resets first.
+*/
+/**************************************************************************/
+void ws_offline_log::consume() {
+  if (_count == 0 || _peekSize == 0)
+    return;
+  _head += _peekSize;
+  _peekSize = 0;
+  _dirty = true;
+  if (--_count == 0)
+    _head = _tail = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Writes the batched records and the file header to flash. The
+              header is left alone if the log has not changed since the
+              last commit.
+    @returns  True if the log was written, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::commit() {
+  if (!_ready || !flush())
+    return false;
+  _committedAt = millis();
+  if (!_dirty)
+    return true;
+  ws_offline_log_hdr_t hdr;
+  hdr.magic = WS_OFFLINE_LOG_MAGIC;
+  hdr.size = WS_OFFLINE_LOG_SIZE;
+  hdr.head = _head;
+  hdr.tail = _tail;
+  hdr.count = _count;
+  if (!writeAt(0, &hdr, sizeof(hdr)) || !syncFile()) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to write the offline log!");
+    return false;
+  }
+  _dirty = false;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Commits the log if it has changed and WS_OFFLINE_LOG_COMMIT_MS
+              has passed since the last commit, so frequent callers do not
+              rewrite the header on every call.
+    @returns  True if the log is committed or not yet due, False if the
+              commit failed.
+*/
+/**************************************************************************/
+bool ws_offline_log::commitDue() {
+  if (!_dirty || millis() - _committedAt < WS_OFFLINE_LOG_COMMIT_MS)
+    return true;
+  return commit();
+}
+
+/**************************************************************************/
+/*!
+    @brief    Discards every message in the log.
+*/
+/**************************************************************************/
+void ws_offline_log::clear() {
+  _head = _tail = _count = 0;
+  _pending = 0;
+  _peekSize = 0;
+  _dirty = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reserves contiguous ring space for a new record. Records are
+              stored in log order, wrapping to the start of the ring once
+              the end is reached.
+    @param    size
+              Bytes needed, including the record header.
+    @param    pos
+              Ring offset of the reserved space.
+    @returns  True if the space was reserved, False if the ring is full.
+*/
+/**************************************************************************/
+bool ws_offline_log::reserve(uint32_t size, uint32_t &pos) {
+  if (_count == 0)
+    _head = _tail = 0;
+  bool wrapped = _count > 0 && _tail <= _head;
+
+  if (!wrapped && _tail + size <= WS_OFFLINE_LOG_SIZE) {
+    pos = _tail;
+  } else if (!wrapped && size <= _head) {
+    // Mark the end of the ring as unused, if a record header fits there
+    if (WS_OFFLINE_LOG_SIZE - _tail >= sizeof(ws_offline_record_t)) {
+      ws_offline_record_t mark = {};
+      mark.len = WS_OFFLINE_LOG_WRAP;
+      if (!stage(_tail, &mark, sizeof(mark)))
+        return false;
+    }
+    pos = 0;
+  } else if (wrapped && _tail + size <= _head) {
+    pos = _tail;
+  } else {
+    return false;
+  }
+  _tail = pos + size;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Overwrites the oldest record to make room for a new one.
+    @returns  True if a record was removed, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::dropOldest() {
+  ws_offline_record_t rec;
+  if (!readHeader(rec))
+    return false;
+  WS_DEBUG_PRINTLN("WARNING: Offline log full, dropping oldest message");
+  _head += sizeof(rec) + rec.len;
+  _dropped++;
+  _dirty = true;
+  if (--_count == 0)
+    _head = _tail = 0;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reads the header of the oldest record, following the wrap
+              back to the start of the ring.
+    @param    rec
+              Record header.
+    @returns  True if a valid header was read, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::readHeader(ws_offline_record_t &rec) {
+  if (!_ready || _count == 0 || !flush())
+    return false;
+  if (WS_OFFLINE_LOG_SIZE - _head < sizeof(rec))
+    _head = 0;
+  bool ok = readAt(sizeof(ws_offline_log_hdr_t) + _head, &rec, sizeof(rec));
+  if (ok && rec.len == WS_OFFLINE_LOG_WRAP) {
+    _head = 0;
+    ok = readAt(sizeof(ws_offline_log_hdr_t), &rec, sizeof(rec));
+  }
+  if (!ok || rec.len > sizeof(_buf) - sizeof(rec) || rec.topicLen >= rec.len ||
+      _head + sizeof(rec) + rec.len > WS_OFFLINE_LOG_SIZE) {
+    WS_DEBUG_PRINTLN("ERROR: Offline log is corrupt, discarding it!");
+    clear();
+    return false;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Adds bytes to the write batch, writing the batch out first if
+              it is full or the bytes do not follow on from it.
+    @param    pos
+              Ring offset to write at.
+    @param    data
+              Bytes to write.
+    @param    len
+              Number of bytes.
+    @returns  True if the bytes were batched, False if a write failed.
+*/
+/**************************************************************************/
+bool ws_offline_log::stage(uint32_t pos, const void *data, uint32_t len) {
+  if (_pending > 0 &&
+      (pos != _pendingPos + _pending || _pending + len > sizeof(_buf))) {
+    if (!flush())
+      return false;
+  }
+  if (_pending == 0)
+    _pendingPos = pos;
+  memcpy(&_buf[_pending], data, len);
+  _pending += len;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Writes the write batch to the log file.
+    @returns  True if the batch was written, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::flush() {
+  if (_pending == 0)
+    return true;
+  bool ok =
+      writeAt(sizeof(ws_offline_log_hdr_t) + _pendingPos, _buf, _pending);
+  _pending = 0;
+  if (!ok)
+    WS_DEBUG_PRINTLN("ERROR: Unable to write the offline log!");
+  return ok;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Opens the log file for reading and writing, creating it if
+              it does not exist.
+    @returns  True if the file was opened, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::openFile() {
+#if defined(USE_TINYUSB)
+  _file = wipperFatFs.open(WS_OFFLINE_LOG_PATH, O_RDWR | O_CREAT);
+  return _file.isOpen();
+#elif defined(USE_LITTLEFS)
+  _file = LittleFS.open(WS_OFFLINE_LOG_PATH,
+                        LittleFS.exists(WS_OFFLINE_LOG_PATH) ? "r+" : "w+");
+  return (bool)_file;
+#else
+  _file = fopen(WS_OFFLINE_LOG_PATH, "r+b");
+  if (_file == nullptr)
+    _file = fopen(WS_OFFLINE_LOG_PATH, "w+b");
+  return _file != nullptr;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Closes the log file.
+*/
+/**************************************************************************/
+void ws_offline_log::closeFile() {
+#if defined(USE_TINYUSB) || defined(USE_LITTLEFS)
+  _file.close();
+#else
+  if (_file != nullptr)
+    fclose(_file);
+  _file = nullptr;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reads bytes from the log file.
+    @param    pos
+              File offset to read from.
+    @param    dst
+              Destination buffer.
+    @param    len
+              Number of bytes to read.
+    @returns  True if every byte was read, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::readAt(uint32_t pos, void *dst, uint32_t len) {
+#if defined(USE_TINYUSB)
+  return _file.seekSet(pos) && _file.read(dst, len) == (int)len;
+#elif defined(USE_LITTLEFS)
+  return _file.seek(pos) && _file.read((uint8_t *)dst, len) == len;
+#else
+  return fseek(_file, (long)pos, SEEK_SET) == 0 &&
+         fread(dst, 1, len, _file) == len;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Writes bytes to the log file.
+    @param    pos
+              File offset to write at.
+    @param    src
+              Bytes to write.
+    @param    len
+              Number of bytes to write.
+    @returns  True if every byte was written, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::writeAt(uint32_t pos, const void *src, uint32_t len) {
+#if defined(USE_TINYUSB)
+  return _file.seekSet(pos) && _file.write(src, len) == len;
+#elif defined(USE_LITTLEFS)
+  return _file.seek(pos) && _file.write((const uint8_t *)src, len) == len;
+#else
+  return fseek(_file, (long)pos, SEEK_SET) == 0 &&
+         fwrite(src, 1, len, _file) == len;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Commits written bytes to the storage medium.
+    @returns  True if successful, False otherwise.
+*/
+/**************************************************************************/
+bool ws_offline_log::syncFile() {
+#if defined(USE_TINYUSB)
+  return _file.sync();
+#elif defined(USE_LITTLEFS)
+  _file.flush();
+  return true;
+#else
+  return fflush(_file) == 0;
+#endif
+}
+
+#endif // WS_USE_OFFLINE_LOG
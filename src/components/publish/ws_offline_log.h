@@ -0,0 +1,146 @@
+/*!
+ * @file ws_offline_log.h
+ *
+ * Store-and-forward log for outbound MQTT messages. While the broker is
+ * unreachable the publish queue spools messages into a fixed-size ring file
+ * on the device's filesystem, they are replayed in capture order once the
+ * connection is restored.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_OFFLINE_LOG_H
+#define WS_OFFLINE_LOG_H
+
+#include "Arduino.h"
+#include "Wippersnapper_Boards.h"
+
+#if defined(USE_TINYUSB)
+#include "SdFat.h"
+#elif defined(USE_LITTLEFS)
+#include <FS.h>
+#include <LittleFS.h>
+#elif defined(WS_NATIVE)
+#include <stdio.h>
+#endif
+
+// TinyUSB boards expose their filesystem to the host as a USB drive, and
+// writing the log while the host has it mounted can corrupt the volume, so
+// the log is only used there if the build defines WS_OFFLINE_LOG_TINYUSB.
+#if !defined(WS_DISABLE_OFFLINE_LOG) &&                                        \
+    ((defined(USE_TINYUSB) && defined(WS_OFFLINE_LOG_TINYUSB)) ||              \
+     defined(USE_LITTLEFS) || defined(WS_NATIVE))
+#define WS_USE_OFFLINE_LOG ///< Board has a filesystem to spool messages to
+#endif
+
+#ifndef WS_OFFLINE_LOG_PATH
+#ifdef WS_NATIVE
+#define WS_OFFLINE_LOG_PATH "wipper_offline.log" ///< Log file, in the cwd
+#else
+#define WS_OFFLINE_LOG_PATH "/wipper_offline.log" ///< Log file on the FS
+#endif
+#endif
+#ifndef WS_OFFLINE_LOG_SIZE
+#define WS_OFFLINE_LOG_SIZE                                                    \
+  32768 ///< Bytes of the filesystem reserved for spooled records
+#endif
+#ifndef WS_OFFLINE_LOG_BUF_SIZE
+#define WS_OFFLINE_LOG_BUF_SIZE                                                \
+  1024 ///< Batched flash write size, also the largest record
+#endif
+#ifndef WS_OFFLINE_LOG_COMMIT_MS
+#define WS_OFFLINE_LOG_COMMIT_MS                                               \
+  30000 ///< Longest time commitDue() leaves changes unwritten, in milliseconds
+#endif
+#define WS_OFFLINE_LOG_MAGIC 0x474F4C57UL ///< "WLOG", marks a valid log file
+#define WS_OFFLINE_LOG_WRAP                                                    \
+  0xFFFF ///< Record length marking the rest of the ring as unused
+
+/** Header at the start of the log file */
+typedef struct {
+  uint32_t magic; ///< WS_OFFLINE_LOG_MAGIC
+  uint32_t size;  ///< Ring size, the log is rebuilt if this changes
+  uint32_t head;  ///< Ring offset of the oldest record
+  uint32_t tail;  ///< Ring offset one past the newest record
+  uint32_t count; ///< Records in the ring
+} ws_offline_log_hdr_t;
+
+/** Header preceding each spooled message */
+typedef struct {
+  uint16_t len;        ///< Topic, terminator and payload bytes that follow
+  uint16_t topicLen;   ///< Topic length, excluding its terminator
+  uint8_t qos;         ///< MQTT quality of service
+  uint8_t reserved[3]; ///< Padding, zero
+} ws_offline_record_t;
+
+/**************************************************************************/
+/*!
+    @brief  Persistent append-only ring of encoded MQTT messages. Appends
+            are collected in RAM and written to flash a block at a time,
+            the file header is only rewritten when a changed log is
+            committed.
+*/
+/**************************************************************************/
+class ws_offline_log {
+public:
+  ws_offline_log(){};
+  ~ws_offline_log();
+
+  bool begin();
+  bool append(const char *topic, const uint8_t *payload, uint16_t len,
+              uint8_t qos);
+  bool peek(const char *&topic, const uint8_t *&payload, uint16_t &len,
+            uint8_t &qos);
+  void consume();
+  bool commit();
+  bool commitDue();
+  void clear();
+  /**************************************************************************/
+  /*!
+      @brief    Checks if any spooled messages are waiting to be replayed.
+      @returns  True if the log holds no messages.
+  */
+  /**************************************************************************/
+  bool isEmpty() { return _count == 0; }
+  uint32_t size() { return _count; }      ///< Messages in the log
+  uint32_t dropped() { return _dropped; } ///< Oldest messages overwritten
+
+private:
+  bool reserve(uint32_t size, uint32_t &pos);
+  bool dropOldest();
+  bool readHeader(ws_offline_record_t &rec);
+  bool stage(uint32_t pos, const void *data, uint32_t len);
+  bool flush();
+  bool openFile();
+  void closeFile();
+  bool readAt(uint32_t pos, void *dst, uint32_t len);
+  bool writeAt(uint32_t pos, const void *src, uint32_t len);
+  bool syncFile();
+
+#if defined(USE_TINYUSB)
+  File32 _file; ///< Log file on the USB mass storage volume
+#elif defined(USE_LITTLEFS)
+  File _file; ///< Log file on LittleFS
+#elif defined(WS_NATIVE)
+  FILE *_file = nullptr; ///< Log file on the host
+#endif
+  bool _ready = false;                   ///< True once the file is open
+  uint8_t _buf[WS_OFFLINE_LOG_BUF_SIZE]; ///< Write batch or replayed record
+  uint32_t _pendingPos = 0;              ///< Ring offset of the write batch
+  uint32_t _pending = 0;                 ///< Bytes in the write batch
+  uint32_t _head = 0;                    ///< Ring offset of the oldest record
+  uint32_t _tail = 0;                    ///< Ring offset of the next record
+  uint32_t _count = 0;                   ///< Records in the ring
+  uint32_t _peekSize = 0;                ///< Ring bytes of the peeked record
+  uint32_t _dropped = 0;                 ///< Records overwritten when full
+  bool _dirty = false;                   ///< True if the header is outdated
+  unsigned long _committedAt = 0;        ///< millis() of the last commit
+};
+
+#endif // WS_OFFLINE_LOG_H
@@ -0,0 +1,164 @@
+/*!
+ * @file ws_pin_event_batch.cpp
+ *
+ * Batches pin events into PinEvents messages.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_pin_event_batch.h"
+#include "Wippersnapper.h"
+
+/**************************************************************************/
+/*!
+    @brief    Starts collecting pin events.
+*/
+/**************************************************************************/
+void ws_pin_event_batch::open() {
+  _count = 0;
+  _open = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Adds a pin event to the batch, queueing the batch first if it
+              is full. If the broker does not accept PinEvents, the event
+              is queued on its own right away instead.
+    @param    msg
+              Signal message holding a pin_event or pin_event_value.
+    @param    key
+              Publish queue coalescing key, used if the event is queued
+              on its own.
+    @returns  True if the event was added, False if it is not a pin event
+              or it, or a full batch, could not be queued.
+*/
+/**************************************************************************/
+bool ws_pin_event_batch::add(
+    const wippersnapper_signal_v1_CreateSignalRequest &msg, uint32_t key) {
+  if (_count == WS_PIN_EVENT_BATCH_LEN && !flush())
+    return false;
+
+  ws_pin_event_t &entry = _events[_count];
+  if (msg.which_payload ==
+      wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag) {
+    entry.numeric = false;
+    entry.event.str = msg.payload.pin_event;
+  } else if (msg.which_payload ==
+             wippersnapper_signal_v1_CreateSignalRequest_pin_event_value_tag) {
+    entry.numeric = true;
+    entry.event.num = msg.payload.pin_event_value;
+  } else {
+    return false;
+  }
+  if (_count == 0)
+    _key = key;
+  _count++;
+  // Brokers that predate PinEvents get one pin event per message
+  if (!WS._pinEventBatches)
+    return flush();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Queues the collected events and stops collecting.
+    @returns  True if the events were queued.
+*/
+/**************************************************************************/
+bool ws_pin_event_batch::close() {
+  _open = false;
+  return flush();
+}
+
+/**************************************************************************/
+/*!
+    @brief    Queues the collected events for publishing, as one PinEvents
+              message, or as a plain pin event if there is only one.
+    @returns  True if the events were queued, or there were none.
+*/
+/**************************************************************************/
+bool ws_pin_event_batch::flush() {
+  if (_count == 0)
+    return true;
+
+  wippersnapper_signal_v1_CreateSignalRequest msg =
+      wippersnapper_signal_v1_CreateSignalRequest_init_zero;
+  uint32_t key = WS_PUBLISH_KEY_NONE;
+  if (_count == 1) {
+    if (_events[0].numeric) {
+      msg.which_payload =
+          wippersnapper_signal_v1_CreateSignalRequest_pin_event_value_tag;
+      msg.payload.pin_event_value = _events[0].event.num;
+    } else {
+      msg.which_payload =
+          wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag;
+      msg.payload.pin_event = _events[0].event.str;
+    }
+    key = _key;
+  } else {
+    msg.which_payload =
+        wippersnapper_signal_v1_CreateSignalRequest_pin_events_tag;
+    msg.payload.pin_events.list.funcs.encode = cbEncodeEvents;
+    msg.payload.pin_events.list.arg = this;
+    msg.payload.pin_events.values.funcs.encode = cbEncodeEvents;
+    msg.payload.pin_events.values.arg = this;
+  }
+
+  size_t msgSz = ws_pb_encode_to_buffer(
+      WS._buffer_outgoing, sizeof(WS._buffer_outgoing),
+      wippersnapper_signal_v1_CreateSignalRequest_fields, &msg);
+  if (msgSz == 0) {
+    WS_DEBUG_PRINTLN("ERROR: Unable to encode pin events");
+    _count = 0;
+    return false;
+  }
+
+  WS_DEBUG_PRINT("Queueing pinEvents: ");
+  WS_DEBUG_PRINTLN(_count);
+  _count = 0;
+  return WS._publishQueue->enqueue(WS._topic_signal_device,
+                                   WS._buffer_outgoing, msgSz, 1, key);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Encodes the batch's string events into PinEvents.list, or its
+              numeric events into PinEvents.values.
+    @param    stream
+              Output stream.
+    @param    field
+              Field being encoded.
+    @param    arg
+              The batch.
+    @returns  True if encoded successfully.
+*/
+/**************************************************************************/
+bool ws_pin_event_batch::cbEncodeEvents(pb_ostream_t *stream,
+                                        const pb_field_t *field,
+                                        void *const *arg) {
+  const ws_pin_event_batch *batch = (const ws_pin_event_batch *)*arg;
+  bool numeric = field->tag == wippersnapper_pin_v1_PinEvents_values_tag;
+  for (uint8_t i = 0; i < batch->_count; i++) {
+    const ws_pin_event_t &entry = batch->_events[i];
+    if (entry.numeric != numeric)
+      continue;
+    if (!pb_encode_tag_for_field(stream, field))
+      return false;
+    bool encoded =
+        numeric ? pb_encode_submessage(
+                      stream, wippersnapper_pin_v1_PinEventValue_fields,
+                      &entry.event.num)
+                : pb_encode_submessage(
+                      stream, wippersnapper_pin_v1_PinEvent_fields,
+                      &entry.event.str);
+    if (!encoded)
+      return false;
+  }
+  return true;
+}
@@ -0,0 +1,75 @@
+/*!
+ * @file ws_pin_event_batch.h
+ *
+ * Collects the pin events a component produces in one pass over its pins
+ * and queues them as a single PinEvents message, so pins sharing a period
+ * cost one MQTT publish and PUBACK instead of one each. Brokers that do not
+ * advertise PinEvents support at registration keep getting one pin event
+ * per message.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_PIN_EVENT_BATCH_H
+#define WS_PIN_EVENT_BATCH_H
+
+#include "Arduino.h"
+#include "pb_encode.h"
+#include "wippersnapper/signal/v1/signal.pb.h"
+
+#ifndef WS_PIN_EVENT_BATCH_LEN
+#define WS_PIN_EVENT_BATCH_LEN                                                 \
+  16 ///< Pin events per message, a fuller batch is queued early
+#endif
+
+/** A pin event waiting in a batch */
+typedef struct {
+  bool numeric; ///< True for a PinEventValue, False for a PinEvent
+  union {
+    wippersnapper_pin_v1_PinEvent str;      ///< String pin event
+    wippersnapper_pin_v1_PinEventValue num; ///< Numeric pin event
+  } event;                                  ///< The event
+} ws_pin_event_t;
+
+/**************************************************************************/
+/*!
+    @brief  Batches pin events between open() and close(), if the broker
+            accepts PinEvents. A batch holding a single event is queued as
+            a plain pin event, keeping its coalescing key.
+*/
+/**************************************************************************/
+class ws_pin_event_batch {
+public:
+  ws_pin_event_batch(){};
+  ~ws_pin_event_batch(){};
+
+  void open();
+  bool add(const wippersnapper_signal_v1_CreateSignalRequest &msg,
+           uint32_t key);
+  bool close();
+  /************************************************************************/
+  /*!
+      @brief    Checks if events are being collected.
+      @returns  True between open() and close().
+  */
+  /************************************************************************/
+  bool isOpen() const { return _open; }
+
+private:
+  bool flush();
+  static bool cbEncodeEvents(pb_ostream_t *stream, const pb_field_t *field,
+                             void *const *arg);
+
+  ws_pin_event_t _events[WS_PIN_EVENT_BATCH_LEN]; ///< Collected events
+  uint8_t _count = 0;                             ///< Events collected
+  uint32_t _key = 0;  ///< Coalescing key of the first event
+  bool _open = false; ///< True between open() and close()
+};
+
+#endif // WS_PIN_EVENT_BATCH_H
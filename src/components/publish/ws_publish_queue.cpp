@@ -0,0 +1,300 @@
+/*!
+ * @file ws_publish_queue.cpp
+ *
+ * Outbound MQTT publish queue.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_publish_queue.h"
+#include "Wippersnapper.h"
+
+/**************************************************************************/
+/*!
+    @brief    Queues an encoded message for publishing. If the queue is
+              full, the oldest messages are spooled to the offline log, or
+              discarded if there is none, to make room.
+    @param    topic
+              MQTT topic to publish to, copied into the queue.
+    @param    payload
+              Encoded message, copied into the queue.
+    @param    len
+              Length of payload, in bytes.
+    @param    qos
+              MQTT quality of service to publish with.
+    @param    key
+              Identifies the feed the message reports, a queued message
+              with the same topic and key is replaced as it is now stale.
+              WS_PUBLISH_KEY_NONE queues every message.
+    @returns  True if the message was queued, False if it can never fit.
+*/
+/**************************************************************************/
+bool ws_publish_queue::enqueue(const char *topic, const uint8_t *payload,
+                               uint16_t len, uint8_t qos, uint32_t key) {
+  size_t topicLen = strlen(topic);
+  if (topicLen + 1 + len > WS_PUBLISH_ARENA_SIZE) {
+    WS_DEBUG_PRINTLN("ERROR: Message is too large for the publish queue!");
+    _dropped++;
+    return false;
+  }
+
+  // Supersede any queued value for the same feed
+  if (key != WS_PUBLISH_KEY_NONE) {
+    for (uint8_t i = 0; i < _count; i++) {
+      ws_publish_msg_t &msg = _msgs[(_head + i) % WS_PUBLISH_QUEUE_LEN];
+      if (!msg.superseded && msg.key == key && msg.topicLen == topicLen &&
+          memcmp(&_arena[msg.offset], topic, topicLen) == 0) {
+        msg.superseded = true;
+        _coalesced++;
+      }
+    }
+  }
+
+  // Spool or discard the oldest messages until there is room
+  uint16_t size = (uint16_t)(topicLen + 1 + len);
+  uint16_t offset;
+  while (_count == WS_PUBLISH_QUEUE_LEN || !reserve(size, offset)) {
+    if (!_msgs[_head].superseded && !spoolOldest()) {
+      WS_DEBUG_PRINTLN("WARNING: Publish queue full, dropping oldest message");
+      _dropped++;
+    }
+    pop();
+  }
+
+  memcpy(&_arena[offset], topic, topicLen + 1);
+  memcpy(&_arena[offset + topicLen + 1], payload, len);
+  ws_publish_msg_t &msg = _msgs[(_head + _count) % WS_PUBLISH_QUEUE_LEN];
+  msg.offset = offset;
+  msg.topicLen = (uint16_t)topicLen;
+  msg.len = len;
+  msg.key = key;
+  msg.qos = qos;
+  msg.attempts = 0;
+  msg.superseded = false;
+  _count++;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Publishes queued messages, oldest first, up to the budget set
+              by setBudget(). Messages spooled to the offline log are
+              replayed before any still in the queue. Stops at the first
+              failure, the message is retried on the next call. While the
+              client is disconnected the queue is spooled instead.
+    @param    mqtt
+              MQTT client.
+    @returns  Number of messages published.
+*/
+/**************************************************************************/
+uint8_t ws_publish_queue::drain(Adafruit_MQTT *mqtt) {
+  if (!mqtt->connected()) {
+    spool(false);
+    return 0;
+  }
+
+  uint8_t published = replay(mqtt, _budget);
+  if (_offlineLog != nullptr && !_offlineLog->isEmpty())
+    return published;
+
+  while (_count > 0 && published < _budget) {
+    ws_publish_msg_t &msg = _msgs[_head];
+    if (msg.superseded) {
+      pop();
+      continue;
+    }
+    if (!mqtt->connected())
+      break;
+
+    WS.feedWDT();
+    if (!mqtt->publish((const char *)&_arena[msg.offset],
+                       &_arena[msg.offset + msg.topicLen + 1], msg.len,
+                       msg.qos)) {
+      WS_DEBUG_PRINTLN("ERROR: MQTT Publish failed!");
+      if (++msg.attempts >= WS_PUBLISH_MAX_ATTEMPTS) {
+        if (!spoolOldest())
+          _dropped++;
+        pop();
+      }
+      break;
+    }
+    pop();
+    published++;
+  }
+  return published;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Moves every queued message to the offline log, so readings
+              survive until the connection to the broker is restored.
+    @param    commit
+              True to write the log to flash now, as when the connection
+              is lost. False leaves it to the offline log's commit
+              interval, for callers that spool on every pass.
+*/
+/**************************************************************************/
+void ws_publish_queue::spool(bool commit) {
+  if (_offlineLog == nullptr)
+    return;
+  uint8_t count = _count;
+  while (_count > 0) {
+    if (!_msgs[_head].superseded && !spoolOldest())
+      break;
+    pop();
+  }
+#ifdef WS_USE_OFFLINE_LOG
+  if (commit)
+    _offlineLog->commit();
+  else
+    _offlineLog->commitDue();
+#endif
+  if (count == 0)
+    return;
+  WS_DEBUG_PRINT("Spooled ");
+  WS_DEBUG_PRINT(count - _count);
+  WS_DEBUG_PRINTLN(" queued messages to the offline log");
+}
+
+/**************************************************************************/
+/*!
+    @brief    Derives a coalescing key from a feed identifier, such as a pin
+              name.
+    @param    id
+              Identifier string.
+    @returns  FNV-1a hash of id, never WS_PUBLISH_KEY_NONE.
+*/
+/**************************************************************************/
+uint32_t ws_publish_queue::keyFor(const char *id) {
+  uint32_t hash = 2166136261UL;
+  while (*id) {
+    hash ^= (uint8_t)*id++;
+    hash *= 16777619UL;
+  }
+  return hash != WS_PUBLISH_KEY_NONE ? hash : 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Reserves contiguous space in the arena for a new message.
+              Messages are stored in queue order, wrapping to the start of
+              the arena once the end is reached.
+    @param    size
+              Bytes needed.
+    @param    offset
+              Start of the reserved space.
+    @returns  True if the space was reserved, False if the arena is full.
+*/
+/**************************************************************************/
+bool ws_publish_queue::reserve(uint16_t size, uint16_t &offset) {
+  if (_count == 0)
+    _write = 0;
+  uint16_t tail = _msgs[_head].offset;
+  bool wrapped = _count > 0 && _write <= tail;
+
+  if (!wrapped && _write + size <= WS_PUBLISH_ARENA_SIZE) {
+    offset = _write;
+  } else if (!wrapped && size <= tail) {
+    offset = 0; // leave the end of the arena unused
+  } else if (wrapped && _write + size <= tail) {
+    offset = _write;
+  } else {
+    return false;
+  }
+  _write = offset + size;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Removes the oldest message from the queue.
+*/
+/**************************************************************************/
+void ws_publish_queue::pop() {
+  _head = (_head + 1) % WS_PUBLISH_QUEUE_LEN;
+  _count--;
+  if (_count == 0)
+    _write = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Appends the oldest queued message to the offline log. The
+              caller removes it from the queue.
+    @returns  True if the message was spooled, False if there is no
+              offline log or it could not be written.
+*/
+/**************************************************************************/
+bool ws_publish_queue::spoolOldest() {
+#ifdef WS_USE_OFFLINE_LOG
+  if (_offlineLog == nullptr)
+    return false;
+  ws_publish_msg_t &msg = _msgs[_head];
+  if (!_offlineLog->append((const char *)&_arena[msg.offset],
+                           &_arena[msg.offset + msg.topicLen + 1], msg.len,
+                           msg.qos))
+    return false;
+  _spooled++;
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief    Publishes messages from the offline log, oldest first. Stops
+              at the first failure, the message is retried on the next call
+              and discarded after WS_PUBLISH_MAX_ATTEMPTS.
+    @param    mqtt
+              Connected MQTT client.
+    @param    budget
+              Maximum number of messages to publish.
+    @returns  Number of messages published.
+*/
+/**************************************************************************/
+uint8_t ws_publish_queue::replay(Adafruit_MQTT *mqtt, uint8_t budget) {
+  uint8_t published = 0;
+#ifdef WS_USE_OFFLINE_LOG
+  if (_offlineLog == nullptr)
+    return 0;
+
+  const char *topic;
+  const uint8_t *payload;
+  uint16_t len;
+  uint8_t qos;
+  bool consumed = false;
+  while (published < budget && mqtt->connected() &&
+         _offlineLog->peek(topic, payload, len, qos)) {
+    WS.feedWDT();
+    bool ok = mqtt->publish(topic, (uint8_t *)payload, len, qos);
+    if (!ok) {
+      WS_DEBUG_PRINTLN("ERROR: MQTT Publish failed!");
+      if (++_replayAttempts < WS_PUBLISH_MAX_ATTEMPTS)
+        break;
+      _dropped++;
+    }
+    _replayAttempts = 0;
+    _offlineLog->consume();
+    consumed = true;
+    if (!ok)
+      break;
+    published++;
+  }
+  // Persist progress at the log's commit interval rather than once per
+  // drain, and at once when the log is empty
+  if (consumed) {
+    if (_offlineLog->isEmpty())
+      _offlineLog->commit();
+    else
+      _offlineLog->commitDue();
+  }
+#endif
+  return published;
+}
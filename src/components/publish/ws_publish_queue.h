@@ -0,0 +1,119 @@
+/*!
+ * @file ws_publish_queue.h
+ *
+ * Outbound MQTT publish queue. Components enqueue encoded messages and
+ * return to sampling, Wippersnapper::run() drains the queue to the broker
+ * a few messages at a time. Messages which can not be sent are spooled to
+ * the offline log, if the board has one, and replayed first on reconnect.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_PUBLISH_QUEUE_H
+#define WS_PUBLISH_QUEUE_H
+
+#include "Adafruit_MQTT.h"
+#include "Arduino.h"
+#include "ws_offline_log.h"
+
+#ifndef WS_PUBLISH_ARENA_SIZE
+#define WS_PUBLISH_ARENA_SIZE                                                  \
+  2048 ///< Bytes reserved for queued topics and payloads
+#endif
+#ifndef WS_PUBLISH_QUEUE_LEN
+#define WS_PUBLISH_QUEUE_LEN 16 ///< Maximum number of queued messages
+#endif
+#define WS_PUBLISH_BUDGET                                                      \
+  4 ///< Default number of messages published per call to drain()
+#define WS_PUBLISH_MAX_ATTEMPTS                                                \
+  3 ///< Publish attempts before a message is discarded
+#define WS_PUBLISH_KEY_NONE                                                    \
+  0 ///< Coalescing key for messages which must all be delivered
+
+/** A message waiting in the publish queue */
+typedef struct {
+  uint16_t offset;   ///< Start of the topic in the arena
+  uint16_t topicLen; ///< Topic length, excluding its terminator
+  uint16_t len;      ///< Payload length, the payload follows the topic
+  uint32_t key;      ///< Coalescing key, WS_PUBLISH_KEY_NONE if unused
+  uint8_t qos;       ///< MQTT quality of service
+  uint8_t attempts;  ///< Failed publish attempts so far
+  bool superseded;   ///< True if a newer message replaced this one
+} ws_publish_msg_t;
+
+/**************************************************************************/
+/*!
+    @brief  Fixed-size FIFO of outbound MQTT messages, backed by a byte
+            arena so queued messages never touch the heap.
+*/
+/**************************************************************************/
+class ws_publish_queue {
+public:
+  ws_publish_queue(){};
+  ~ws_publish_queue(){};
+
+  bool enqueue(const char *topic, const uint8_t *payload, uint16_t len,
+               uint8_t qos, uint32_t key = WS_PUBLISH_KEY_NONE);
+  uint8_t drain(Adafruit_MQTT *mqtt);
+  void spool(bool commit = true);
+  static uint32_t keyFor(const char *id);
+  /**************************************************************************/
+  /*!
+      @brief    Sets the log messages are spooled to while offline.
+      @param    log
+                Offline log, opened with begin(), or nullptr for none.
+  */
+  /**************************************************************************/
+  void setOfflineLog(ws_offline_log *log) { _offlineLog = log; }
+  /**************************************************************************/
+  /*!
+      @brief    Sets how many messages each call to drain() may publish.
+                Each QoS 1 publish waits for its PUBACK, so this bounds
+                the time one pass of run() spends publishing rather than
+                the number of messages in flight.
+      @param    budget
+                Messages per drain, at least 1.
+  */
+  /**************************************************************************/
+  void setBudget(uint8_t budget) { _budget = budget > 0 ? budget : 1; }
+  /**************************************************************************/
+  /*!
+      @brief    Checks if any messages are waiting to be published.
+      @returns  True if neither the queue nor the offline log hold any
+                messages.
+  */
+  /**************************************************************************/
+  bool isEmpty() {
+    return _count == 0 && (_offlineLog == nullptr || _offlineLog->isEmpty());
+  }
+  uint8_t size() { return _count; }           ///< Messages in the queue
+  uint32_t dropped() { return _dropped; }     ///< Messages discarded
+  uint32_t coalesced() { return _coalesced; } ///< Messages replaced
+  uint32_t spooled() { return _spooled; }     ///< Messages sent to the log
+
+private:
+  bool reserve(uint16_t size, uint16_t &offset);
+  void pop();
+  bool spoolOldest();
+  uint8_t replay(Adafruit_MQTT *mqtt, uint8_t budget);
+
+  uint8_t _arena[WS_PUBLISH_ARENA_SIZE];        ///< Topic and payload storage
+  ws_publish_msg_t _msgs[WS_PUBLISH_QUEUE_LEN]; ///< Ring of queued messages
+  uint8_t _head = 0;                            ///< Index of the oldest message
+  uint8_t _count = 0;                           ///< Messages in the ring
+  uint16_t _write = 0;                          ///< Next free byte in the arena
+  uint8_t _budget = WS_PUBLISH_BUDGET;          ///< Messages sent per drain
+  uint32_t _dropped = 0;                        ///< Messages discarded
+  uint32_t _coalesced = 0;                      ///< Replaced by newer values
+  uint32_t _spooled = 0;                        ///< Sent to the offline log
+  ws_offline_log *_offlineLog = nullptr;        ///< Spool for offline periods
+  uint8_t _replayAttempts = 0;                  ///< Failed replays of a record
+};
+
+#endif // WS_PUBLISH_QUEUE_H
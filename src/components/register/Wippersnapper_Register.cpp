@@ -97,15 +97,12 @@ void Wippersnapper::pollRegistrationResp() {
 /****************************************************************************/
 void Wippersnapper::decodeRegistrationResp(char *data, uint16_t len) {
   WS_DEBUG_PRINTLN("GOT Registration Response Message:");
-  uint8_t buffer[len];
-  memcpy(buffer, data, len);
-
   // init. CreateDescriptionResponse message
   wippersnapper_description_v1_CreateDescriptionResponse message =
       wippersnapper_description_v1_CreateDescriptionResponse_init_zero;
 
-  // create input stream for buffer
-  pb_istream_t stream = pb_istream_from_buffer(buffer, len);
+  // decode in place from the MQTT client's buffer
+  pb_istream_t stream = pb_istream_from_buffer((pb_byte_t *)data, len);
   // decode the stream
   if (!ws_pb_decode(
           &stream,
@@ -124,6 +121,15 @@ void Wippersnapper::decodeRegistrationResp(char *data, uint16_t len) {
     WS_DEBUG_PRINT("\tReference voltage: ");
     WS_DEBUG_PRINT(message.reference_voltage);
     WS_DEBUG_PRINTLN("v");
+    WS_DEBUG_PRINT("\tNumeric pin events: ");
+    WS_DEBUG_PRINTLN(message.numeric_pin_events);
+    WS._numericPinEvents = message.numeric_pin_events;
+    WS_DEBUG_PRINT("\tPin event batches: ");
+    WS_DEBUG_PRINTLN(message.pin_event_batches);
+    WS._pinEventBatches = message.pin_event_batches;
+    WS_DEBUG_PRINT("\tDS18x20 sensor addresses: ");
+    WS_DEBUG_PRINTLN(message.ds18x20_sensor_addresses);
+    WS._ds18x20SensorAddresses = message.ds18x20_sensor_addresses;
     // Initialize Digital IO class
     WS._digitalGPIO = new Wippersnapper_DigitalGPIO(message.total_gpio_pins);
     // Initialize Analog IO class
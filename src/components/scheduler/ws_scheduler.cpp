@@ -0,0 +1,182 @@
+/*!
+ * @file ws_scheduler.cpp
+ *
+ * Deadline scheduler for the WipperSnapper application loop.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_scheduler.h"
+
+#define WS_TASK_NOT_QUEUED 0xFF ///< _pos value for a task outside the heap
+
+/**************************************************************************/
+/*!
+    @brief    Creates a scheduler with every task due immediately.
+*/
+/**************************************************************************/
+ws_scheduler::ws_scheduler() {
+  for (uint8_t i = 0; i < WS_TASK_COUNT; i++)
+    _pos[i] = WS_TASK_NOT_QUEUED;
+  for (uint8_t i = 0; i < WS_TASK_COUNT; i++)
+    schedule((ws_task_t)i, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Compares two millis() timestamps, tolerating rollover.
+    @param    a
+              First timestamp.
+    @param    b
+              Second timestamp.
+    @returns  True if a is earlier than b.
+*/
+/**************************************************************************/
+bool ws_scheduler::before(unsigned long a, unsigned long b) {
+  return (long)(a - b) < 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Returns the earlier of two millis() timestamps.
+    @param    a
+              First timestamp.
+    @param    b
+              Second timestamp.
+    @returns  The earlier timestamp, tolerating rollover.
+*/
+/**************************************************************************/
+unsigned long ws_scheduler::earliest(unsigned long a, unsigned long b) {
+  return before(a, b) ? a : b;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Sets when a task next needs to run. A task which is already
+              queued is moved to its new position.
+    @param    task
+              Task to schedule.
+    @param    dueMs
+              Deadline, as a millis() timestamp.
+*/
+/**************************************************************************/
+void ws_scheduler::schedule(ws_task_t task, unsigned long dueMs) {
+  _due[task] = dueMs;
+  if (_pos[task] == WS_TASK_NOT_QUEUED) {
+    _heap[_heapSize] = task;
+    _pos[task] = _heapSize;
+    _heapSize++;
+  }
+  siftUp(_pos[task]);
+  siftDown(_pos[task]);
+}
+
+/**************************************************************************/
+/*!
+    @brief    Makes a task due immediately, used when its configuration
+              changes.
+    @param    task
+              Task to wake.
+*/
+/**************************************************************************/
+void ws_scheduler::wake(ws_task_t task) { schedule(task, millis()); }
+
+/**************************************************************************/
+/*!
+    @brief    Removes the earliest task from the queue if its deadline has
+              passed. The caller must schedule() it again once it has run.
+    @param    curTime
+              Current millis() timestamp.
+    @param    task
+              Set to the task which is due.
+    @returns  True if a task was due, False otherwise.
+*/
+/**************************************************************************/
+bool ws_scheduler::popDue(unsigned long curTime, ws_task_t &task) {
+  if (_heapSize == 0 || before(curTime, _due[_heap[0]]))
+    return false;
+  task = (ws_task_t)_heap[0];
+  _heapSize--;
+  if (_heapSize > 0) {
+    swap(0, _heapSize);
+    siftDown(0);
+  }
+  _pos[task] = WS_TASK_NOT_QUEUED;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Returns the time remaining until the earliest deadline.
+    @param    curTime
+              Current millis() timestamp.
+    @returns  Milliseconds until the next task is due, 0 if one is overdue.
+*/
+/**************************************************************************/
+unsigned long ws_scheduler::msUntilNext(unsigned long curTime) {
+  if (_heapSize == 0 || !before(curTime, _due[_heap[0]]))
+    return 0;
+  return _due[_heap[0]] - curTime;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Swaps two heap entries and updates their positions.
+    @param    a
+              First heap index.
+    @param    b
+              Second heap index.
+*/
+/**************************************************************************/
+void ws_scheduler::swap(uint8_t a, uint8_t b) {
+  uint8_t tmp = _heap[a];
+  _heap[a] = _heap[b];
+  _heap[b] = tmp;
+  _pos[_heap[a]] = a;
+  _pos[_heap[b]] = b;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Moves a heap entry towards the root while it is earlier than
+              its parent.
+    @param    idx
+              Heap index.
+*/
+/**************************************************************************/
+void ws_scheduler::siftUp(uint8_t idx) {
+  while (idx > 0) {
+    uint8_t parent = (idx - 1) / 2;
+    if (!before(_due[_heap[idx]], _due[_heap[parent]]))
+      break;
+    swap(idx, parent);
+    idx = parent;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief    Moves a heap entry towards the leaves while a child is earlier.
+    @param    idx
+              Heap index.
+*/
+/**************************************************************************/
+void ws_scheduler::siftDown(uint8_t idx) {
+  for (;;) {
+    uint8_t left = 2 * idx + 1, right = left + 1, smallest = idx;
+    if (left < _heapSize && before(_due[_heap[left]], _due[_heap[smallest]]))
+      smallest = left;
+    if (right < _heapSize && before(_due[_heap[right]], _due[_heap[smallest]]))
+      smallest = right;
+    if (smallest == idx)
+      break;
+    swap(idx, smallest);
+    idx = smallest;
+  }
+}
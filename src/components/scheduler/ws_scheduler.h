@@ -0,0 +1,65 @@
+/*!
+ * @file ws_scheduler.h
+ *
+ * Deadline scheduler for the WipperSnapper application loop. Each
+ * periodic task registers the time it next needs to run, and run() only
+ * services the tasks whose deadline has passed.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_SCHEDULER_H
+#define WS_SCHEDULER_H
+
+#include "Arduino.h"
+
+#define WS_SCHEDULER_IDLE_MS                                                   \
+  60000 ///< Deadline offset used by tasks with nothing configured
+
+/** Tasks serviced by Wippersnapper::run() */
+typedef enum {
+  WS_TASK_KEEPALIVE,  ///< MQTT keepalive ping and status LED blink
+  WS_TASK_DIGITAL_IN, ///< Digital input pins
+  WS_TASK_ANALOG_IN,  ///< Analog input pins
+  WS_TASK_I2C,        ///< I2C sensor drivers
+  WS_TASK_DS18X20,    ///< DS18x20 sensors
+  WS_TASK_UART,       ///< UART sensor drivers
+  WS_TASK_PIXELS,     ///< Pixel strand animation frames
+  WS_TASK_COUNT       ///< Number of tasks, must be last
+} ws_task_t;
+
+/**************************************************************************/
+/*!
+    @brief  Min-heap of task deadlines, keyed by millis().
+*/
+/**************************************************************************/
+class ws_scheduler {
+public:
+  ws_scheduler();
+  ~ws_scheduler(){};
+
+  void schedule(ws_task_t task, unsigned long dueMs);
+  void wake(ws_task_t task);
+  bool popDue(unsigned long curTime, ws_task_t &task);
+  unsigned long msUntilNext(unsigned long curTime);
+  static unsigned long earliest(unsigned long a, unsigned long b);
+
+private:
+  static bool before(unsigned long a, unsigned long b);
+  void siftUp(uint8_t idx);
+  void siftDown(uint8_t idx);
+  void swap(uint8_t a, uint8_t b);
+
+  unsigned long _due[WS_TASK_COUNT]; ///< Deadline of each task, in millis
+  uint8_t _heap[WS_TASK_COUNT];      ///< Heap of task ids, earliest first
+  uint8_t _pos[WS_TASK_COUNT];       ///< Heap index of each task
+  uint8_t _heapSize = 0;             ///< Tasks currently in the heap
+};
+
+#endif // WS_SCHEDULER_H
@@ -16,6 +16,7 @@
 #ifndef WS_UART_DRV_H
 #define WS_UART_DRV_H
 #include "Wippersnapper.h"
+#include "ws_uart_frame.h"
 #include <Adafruit_Sensor.h>
 
 // ESP8266 platform uses SoftwareSerial
@@ -28,6 +29,14 @@
 #include <HardwareSerial.h>
 #endif
 
+#ifndef WS_UART_RX_RING_LEN
+#define WS_UART_RX_RING_LEN                                                    \
+  128 ///< Received bytes buffered for parsing, holds several frames
+#endif
+#define WS_UART_RX_SERVICE_MS                                                  \
+  20 ///< Time between moving received bytes into the RX ring, in
+     ///< milliseconds. 9600 baud fills a 64 byte UART FIFO in ~66 ms.
+
 /**************************************************************************/
 /*!
     @brief  Base class for UART Device Drivers.
@@ -45,7 +54,7 @@ public:
                 How often the UART device will be polled, in milliseconds.
   */
   /*******************************************************************************/
-  ws_uart_drv(SoftwareSerial *swSerial, int32_t interval){};
+  ws_uart_drv(SoftwareSerial *swSerial, int32_t interval) : _uart(swSerial){};
 #else
   /*******************************************************************************/
   /*!
@@ -56,9 +65,14 @@ public:
                 How often the UART device will be polled, in milliseconds.
   */
   /*******************************************************************************/
-  ws_uart_drv(HardwareSerial *hwSerial, int32_t interval){};
+  ws_uart_drv(HardwareSerial *hwSerial, int32_t interval) : _uart(hwSerial){};
 #endif
-  ~ws_uart_drv(void) {}
+  /*******************************************************************************/
+  /*!
+      @brief    Destructor for a UART device driver.
+  */
+  /*******************************************************************************/
+  virtual ~ws_uart_drv(void) { free((void *)_driverID); }
 
   /*******************************************************************************/
   /*!
@@ -83,6 +97,14 @@ public:
   /*******************************************************************************/
   void setPrvPollTime(unsigned long curTime) { _prvPoll = curTime; }
 
+  /*******************************************************************************/
+  /*!
+      @brief   Returns when the UART device is next ready to be polled.
+      @returns Deadline as a millis() timestamp.
+  */
+  /*******************************************************************************/
+  unsigned long getNextPollTime() { return _prvPoll + pollingInterval + 1; }
+
   /*******************************************************************************/
   /*!
       @brief   Gets the UART device's unique identifier.
@@ -162,11 +184,193 @@ public:
   /*******************************************************************************/
   virtual void send_data(){};
 
+  /*******************************************************************************/
+  /*!
+      @brief   Moves the bytes the UART has received into the RX ring, then
+               lets the driver parse them. Never waits for data, so it is
+               called on every update() rather than at the polling interval.
+  */
+  /*******************************************************************************/
+  void serviceRx() {
+    if (_uart == nullptr)
+      return;
+    int avail = _uart->available();
+    while (avail-- > 0 && _rxCount < WS_UART_RX_RING_LEN) {
+      _rxBuf[(_rxHead + _rxCount) % WS_UART_RX_RING_LEN] = _uart->read();
+      _rxCount++;
+    }
+    parseRx();
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Parses the bytes waiting in the RX ring, consuming complete
+               frames. Drivers which stream data override this.
+  */
+  /*******************************************************************************/
+  virtual void parseRx() {}
+
   const char *uartTopic = nullptr;     ///< UART device's MQTT topic
   Adafruit_MQTT *mqttClient = nullptr; ///< Pointer to MQTT client object
   unsigned long
       pollingInterval; ///< UART device's polling interval, in milliseconds
+protected:
+  /*******************************************************************************/
+  /*!
+      @brief   Returns a byte from the RX ring without consuming it.
+      @param   idx
+               Offset from the oldest byte.
+      @returns The byte.
+  */
+  /*******************************************************************************/
+  uint8_t rxPeek(size_t idx) {
+    return _rxBuf[(_rxHead + idx) % WS_UART_RX_RING_LEN];
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Returns a big-endian 16-bit word from the RX ring without
+               consuming it.
+      @param   idx
+               Offset of the word's high byte from the oldest byte.
+      @returns The word.
+  */
+  /*******************************************************************************/
+  uint16_t rxPeek16(size_t idx) {
+    return ((uint16_t)rxPeek(idx) << 8) | rxPeek(idx + 1);
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Consumes bytes from the RX ring.
+      @param   len
+               Number of bytes to consume.
+  */
+  /*******************************************************************************/
+  void rxDrop(size_t len) {
+    _rxHead = (_rxHead + len) % WS_UART_RX_RING_LEN;
+    _rxCount -= len;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Sends bytes to the UART device.
+      @param   buf
+               Bytes to send.
+      @param   len
+               Number of bytes.
+  */
+  /*******************************************************************************/
+  void txWrite(const uint8_t *buf, size_t len) {
+    if (_uart != nullptr)
+      _uart->write(buf, len);
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Checks the frame at the start of the RX ring against a
+               frame description. Header and length bytes are checked as
+               soon as they arrive, so a stray byte is skipped without
+               waiting for a whole frame.
+      @param   desc
+               Frame description.
+      @param   frameLen
+               Length of the frame, set when it is known.
+      @returns 1 if a complete frame with a valid checksum is waiting, 0 if
+               more bytes are needed, -1 if the ring does not start with a
+               frame.
+  */
+  /*******************************************************************************/
+  int checkFrame(const ws_uart_frame_t *desc, size_t &frameLen) {
+    for (size_t i = 0; i < desc->headerLen && i < _rxCount; i++) {
+      if (rxPeek(i) != desc->header[i])
+        return -1;
+    }
+    frameLen = desc->frameLen;
+    if (desc->lengthOffset != 0) {
+      if (_rxCount < (size_t)desc->lengthOffset + 2)
+        return 0;
+      frameLen = rxPeek16(desc->lengthOffset) + desc->lengthBias;
+      if (frameLen > desc->frameLen ||
+          frameLen < (size_t)desc->lengthOffset + 2)
+        return -1;
+    }
+    if (frameLen > WS_UART_RX_RING_LEN)
+      return -1; // would never fit in the ring
+    if (_rxCount < frameLen)
+      return 0;
+
+    size_t end = frameLen;
+    switch (desc->checksum) {
+    case WS_UART_CHECKSUM_SUM16_BE: {
+      uint16_t sum = 0;
+      for (size_t i = desc->checksumStart; i < end - 2; i++)
+        sum += rxPeek(i);
+      return sum == rxPeek16(end - 2) ? 1 : -1;
+    }
+    case WS_UART_CHECKSUM_SUM8_ZERO: {
+      uint8_t sum = 0;
+      for (size_t i = desc->checksumStart; i < end; i++)
+        sum += rxPeek(i);
+      return sum == 0 ? 1 : -1;
+    }
+    case WS_UART_CHECKSUM_CRC16_MODBUS: {
+      uint16_t crc = 0xFFFF;
+      for (size_t i = desc->checksumStart; i < end - 2; i++) {
+        crc ^= rxPeek(i);
+        for (uint8_t bit = 0; bit < 8; bit++)
+          crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+      }
+      return crc == (rxPeek(end - 2) | ((uint16_t)rxPeek(end - 1) << 8))
+                 ? 1
+                 : -1;
+    }
+    default:
+      return 1;
+    }
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Parses the next frame from the RX ring into the values its
+               description lists, without allocating. Bytes that cannot
+               start a valid frame are dropped one at a time, so parsing
+               resynchronizes on the next header.
+      @param   desc
+               Frame description.
+      @param   values
+               Values decoded from the frame, scaled, in the order of
+               desc->fields.
+      @returns True if a frame was parsed, False if more bytes are needed.
+  */
+  /*******************************************************************************/
+  bool parseFrame(const ws_uart_frame_t *desc, float *values) {
+    size_t frameLen;
+    while (_rxCount > 0) {
+      int frame = checkFrame(desc, frameLen);
+      if (frame == 0)
+        return false;
+      if (frame < 0) {
+        rxDrop(1);
+        continue;
+      }
+      for (uint8_t i = 0; i < desc->fieldCount; i++) {
+        const ws_uart_field_t &field = desc->fields[i];
+        uint16_t raw = field.width == 2 ? rxPeek16(field.offset)
+                                        : rxPeek(field.offset);
+        values[i] = raw * field.scale;
+      }
+      rxDrop(frameLen);
+      return true;
+    }
+    return false;
+  }
+
 private:
+  Stream *_uart = nullptr;             ///< UART the device is attached to
+  uint8_t _rxBuf[WS_UART_RX_RING_LEN]; ///< Received bytes awaiting parsing
+  size_t _rxHead = 0;                  ///< Index of the oldest byte
+  size_t _rxCount = 0;                 ///< Bytes in the ring
   long _prvPoll = millis() - (24 * 60 * 60 * 1000);
   ///< Last time (ms) the UART device was polled, set to 24 hours (max period)
   const char *_driverID = nullptr; ///< UART device's ID
@@ -0,0 +1,172 @@
+/*!
+ * @file ws_uart_drv_frame.h
+ *
+ * WipperSnapper device driver for UART sensors described by a
+ * ws_uart_frame_t, such as the PMS5003, PM1006, ZH06, SenseAir S8 and
+ * MH-Z19.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Brent Rubell 2023 for Adafruit Industries.
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_UART_DRV_FRAME_H
+#define WS_UART_DRV_FRAME_H
+
+#include "Wippersnapper.h"
+#include "ws_uart_drv.h"
+
+#define WS_UART_QUERY_TIMEOUT_MS                                               \
+  1000 ///< Time to wait for a response before querying the sensor again
+
+/**************************************************************************/
+/*!
+    @brief  Class that provides an interface for a UART sensor whose frames
+            are described by a ws_uart_frame_t.
+*/
+/**************************************************************************/
+class ws_uart_drv_frame : public ws_uart_drv {
+public:
+#ifdef USE_SW_UART
+  /*******************************************************************************/
+  /*!
+      @brief    Initializes a framed UART device driver.
+      @param    swSerial
+                Pointer to an instance of a SoftwareSerial object.
+      @param    interval
+                How often the device will be polled, in milliseconds.
+      @param    frame
+                Description of the frames the device sends.
+  */
+  /*******************************************************************************/
+  ws_uart_drv_frame(SoftwareSerial *swSerial, int32_t interval,
+                    const ws_uart_frame_t *frame)
+      : ws_uart_drv(swSerial, interval) {
+    _frame = frame;
+    pollingInterval = (unsigned long)interval;
+  };
+#else
+  /*******************************************************************************/
+  /*!
+      @brief    Initializes a framed UART device driver.
+      @param    hwSerial
+                Pointer to an instance of a HardwareSerial object.
+      @param    interval
+                How often the device will be polled, in milliseconds.
+      @param    frame
+                Description of the frames the device sends.
+  */
+  /*******************************************************************************/
+  ws_uart_drv_frame(HardwareSerial *hwSerial, int32_t interval,
+                    const ws_uart_frame_t *frame)
+      : ws_uart_drv(hwSerial, interval) {
+    _frame = frame;
+    pollingInterval = (unsigned long)interval;
+  };
+#endif // USE_SW_UART
+
+  /*******************************************************************************/
+  /*!
+      @brief   Initializes the device. Frames are parsed by the ws_uart_drv
+               base as they arrive.
+      @returns True if the device was successfully initialized, False
+               otherwise.
+  */
+  /*******************************************************************************/
+  bool begin() override {
+    return _frame != nullptr &&
+           _frame->fieldCount <= WS_UART_FRAME_MAX_FIELDS;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Parses the frames received so far, keeping the newest
+               reading.
+  */
+  /*******************************************************************************/
+  void parseRx() override {
+    while (parseFrame(_frame, _values))
+      _hasData = true;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Checks for a reading from the device, without waiting for
+               one. Devices which only answer queries are sent one.
+      @returns True if a reading was parsed since the last call, False
+               otherwise.
+  */
+  /*******************************************************************************/
+  bool read_data() override {
+    if (_hasData) {
+      _hasData = false;
+      return true;
+    }
+    if (_frame->query != nullptr &&
+        millis() - _queryTime > WS_UART_QUERY_TIMEOUT_MS) {
+      txWrite(_frame->query, _frame->queryLen);
+      _queryTime = millis();
+    }
+    return false;
+  }
+
+  /*******************************************************************************/
+  /*!
+      @brief   Packs and sends the device's event data to Adafruit IO.
+  */
+  /*******************************************************************************/
+  void send_data() override {
+    // Create a new UART response message
+    wippersnapper_signal_v1_UARTResponse msgUARTResponse =
+        wippersnapper_signal_v1_UARTResponse_init_zero;
+    msgUARTResponse.which_payload =
+        wippersnapper_signal_v1_UARTResponse_resp_uart_device_event_tag;
+    strcpy(msgUARTResponse.payload.resp_uart_device_event.device_id,
+           getDriverID());
+
+    // Report every field the frame carries
+    msgUARTResponse.payload.resp_uart_device_event.sensor_event_count =
+        _frame->fieldCount;
+    for (uint8_t i = 0; i < _frame->fieldCount; i++) {
+      packUARTResponse(&msgUARTResponse, i, _frame->fields[i].type,
+                       _values[i]);
+      WS_DEBUG_PRINT("[UART] ");
+      WS_DEBUG_PRINT(getDriverID());
+      WS_DEBUG_PRINT(" sensor type ");
+      WS_DEBUG_PRINT(_frame->fields[i].type);
+      WS_DEBUG_PRINT(": ");
+      WS_DEBUG_PRINTLN(_values[i]);
+    }
+
+    // Encode message data
+    uint8_t mqttBuffer[512];
+    size_t msgSz = ws_pb_encode_to_buffer(
+        mqttBuffer, sizeof(mqttBuffer),
+        wippersnapper_signal_v1_UARTResponse_fields, &msgUARTResponse);
+    if (msgSz == 0) {
+      WS_DEBUG_PRINTLN("[ERROR, UART]: Unable to encode device response!");
+      return;
+    }
+
+    // Publish message to IO
+    WS_DEBUG_PRINT("[UART] Queueing event for IO..");
+    WS._publishQueue->enqueue(uartTopic, mqttBuffer, msgSz, 1,
+                              ws_publish_queue::keyFor(getDriverID()));
+    WS_DEBUG_PRINTLN("Queued!");
+
+    setPrvPollTime(millis());
+  }
+
+protected:
+  const ws_uart_frame_t *_frame = nullptr; ///< Frames the device sends
+  float _values[WS_UART_FRAME_MAX_FIELDS]; ///< Newest reading, per field
+  bool _hasData = false; ///< True if _values was parsed since read_data()
+  unsigned long _queryTime =
+      millis() - WS_UART_QUERY_TIMEOUT_MS - 1; ///< Last query, in millis
+};
+
+#endif // WS_UART_DRV_FRAME_H
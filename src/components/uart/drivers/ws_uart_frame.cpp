@@ -0,0 +1,89 @@
+/*!
+ * @file ws_uart_frame.cpp
+ *
+ * Frame descriptions of the supported UART sensors.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+#include "ws_uart_frame.h"
+
+// Plantower PMS5003, streams 0x42 0x4D, length 28, 13 words, 16-bit sum
+static const ws_uart_field_t _pms5003Fields[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_STD, 4, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_STD, 6, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_STD, 8, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_ENV, 10, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_ENV, 12, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_ENV, 14, 2, 1.0f},
+};
+
+// Cubic PM1006, streams 0x16 0x11 0x0B, 16 data bytes, bytes sum to zero
+static const ws_uart_field_t _pm1006Fields[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_ENV, 5, 2, 1.0f},
+};
+
+// Winsen ZH06, initiative upload mode, PMS5003 framing with PM1.0, PM2.5
+// and PM10 in the third to fifth words
+static const ws_uart_field_t _zh06Fields[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM10_ENV, 10, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM25_ENV, 12, 2, 1.0f},
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_PM100_ENV, 14, 2, 1.0f},
+};
+
+// SenseAir S8, Modbus read of input register 3 (CO2, ppm)
+static const uint8_t _senseairS8Query[] = {0xFE, 0x04, 0x00, 0x03,
+                                           0x00, 0x01, 0xD5, 0xC5};
+static const ws_uart_field_t _senseairS8Fields[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2, 3, 2, 1.0f},
+};
+
+// Winsen MH-Z19, command 0x86 reads CO2, in ppm. Bytes after the start
+// byte sum to zero.
+static const uint8_t _mhz19Query[] = {0xFF, 0x01, 0x86, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x79};
+static const ws_uart_field_t _mhz19Fields[] = {
+    {wippersnapper_i2c_v1_SensorType_SENSOR_TYPE_CO2, 2, 2, 1.0f},
+};
+
+/** Every UART sensor WipperSnapper can parse */
+static const ws_uart_frame_t _frames[] = {
+    {"pms5003", {0x42, 0x4D}, 2, 32, 2, 4, WS_UART_CHECKSUM_SUM16_BE, 0,
+     nullptr, 0, _pms5003Fields,
+     sizeof(_pms5003Fields) / sizeof(_pms5003Fields[0])},
+    {"pm1006", {0x16, 0x11, 0x0B}, 3, 20, 0, 0, WS_UART_CHECKSUM_SUM8_ZERO, 0,
+     nullptr, 0, _pm1006Fields,
+     sizeof(_pm1006Fields) / sizeof(_pm1006Fields[0])},
+    {"zh06", {0x42, 0x4D}, 2, 32, 2, 4, WS_UART_CHECKSUM_SUM16_BE, 0, nullptr,
+     0, _zh06Fields, sizeof(_zh06Fields) / sizeof(_zh06Fields[0])},
+    {"senseair_s8", {0xFE, 0x04, 0x02}, 3, 7, 0, 0,
+     WS_UART_CHECKSUM_CRC16_MODBUS, 0, _senseairS8Query,
+     sizeof(_senseairS8Query), _senseairS8Fields,
+     sizeof(_senseairS8Fields) / sizeof(_senseairS8Fields[0])},
+    {"mh_z19", {0xFF, 0x86}, 2, 9, 0, 0, WS_UART_CHECKSUM_SUM8_ZERO, 1,
+     _mhz19Query, sizeof(_mhz19Query), _mhz19Fields,
+     sizeof(_mhz19Fields) / sizeof(_mhz19Fields[0])},
+};
+
+/**************************************************************************/
+/*!
+    @brief    Finds the frame description of a UART sensor.
+    @param    deviceId
+              device_id the broker attaches the sensor with.
+    @returns  The sensor's frame description, or nullptr if the sensor is
+              not supported.
+*/
+/**************************************************************************/
+const ws_uart_frame_t *ws_uart_find_frame(const char *deviceId) {
+  for (const ws_uart_frame_t &frame : _frames) {
+    if (strcmp(frame.deviceId, deviceId) == 0)
+      return &frame;
+  }
+  return nullptr;
+}
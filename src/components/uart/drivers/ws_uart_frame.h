@@ -0,0 +1,68 @@
+/*!
+ * @file ws_uart_frame.h
+ *
+ * Declarative descriptions of the frames UART sensors send, so a new
+ * sensor is added to the table in ws_uart_frame.cpp rather than written
+ * as its own driver.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+#ifndef WS_UART_FRAME_H
+#define WS_UART_FRAME_H
+
+#include "Arduino.h"
+#include "wippersnapper/i2c/v1/i2c.pb.h"
+
+#define WS_UART_FRAME_MAX_HEADER 4 ///< Longest frame header, in bytes
+#define WS_UART_FRAME_MAX_FIELDS                                               \
+  15 ///< Most fields reported from a frame, the capacity of UARTDeviceEvent
+
+/** How a frame's integrity is checked */
+typedef enum {
+  WS_UART_CHECKSUM_NONE,     ///< No checksum
+  WS_UART_CHECKSUM_SUM16_BE, ///< 16-bit sum of the bytes before it, stored
+                             ///< big-endian in the last two bytes
+  WS_UART_CHECKSUM_SUM8_ZERO, ///< 8-bit sum of the bytes, including the
+                              ///< checksum byte, is zero
+  WS_UART_CHECKSUM_CRC16_MODBUS, ///< Modbus CRC-16 of the bytes before it,
+                                 ///< stored little-endian in the last two
+                                 ///< bytes
+} ws_uart_checksum_t;
+
+/** A value carried in a frame */
+typedef struct {
+  wippersnapper_i2c_v1_SensorType type; ///< Sensor type the value reports
+  uint8_t offset; ///< Offset of the big-endian value from the frame start
+  uint8_t width;  ///< Width of the value, 1 or 2 bytes
+  float scale;    ///< Multiplier from the raw value to the reported unit
+} ws_uart_field_t;
+
+/** Layout of the frames a UART sensor sends */
+typedef struct {
+  const char *deviceId; ///< device_id the broker attaches the sensor with
+  uint8_t header[WS_UART_FRAME_MAX_HEADER]; ///< Bytes every frame starts with
+  uint8_t headerLen;                        ///< Bytes of header used
+  uint8_t frameLen;     ///< Frame length, or the longest frame accepted if
+                        ///< the frame has a length field
+  uint8_t lengthOffset; ///< Offset of a big-endian 16-bit length field, 0 if
+                        ///< frames have a fixed length
+  uint8_t lengthBias;   ///< Bytes of the frame the length field excludes
+  ws_uart_checksum_t checksum; ///< How the frame is checked
+  uint8_t checksumStart;       ///< First byte covered by the checksum
+  const uint8_t *query; ///< Bytes requesting a frame, nullptr if the sensor
+                        ///< sends frames on its own
+  uint8_t queryLen;     ///< Length of query
+  const ws_uart_field_t *fields; ///< Values carried in the frame
+  uint8_t fieldCount;            ///< Number of fields
+} ws_uart_frame_t;
+
+const ws_uart_frame_t *ws_uart_find_frame(const char *deviceId);
+
+#endif // WS_UART_FRAME_H
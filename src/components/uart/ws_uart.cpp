@@ -21,21 +21,20 @@
 */
 /*******************************************************************************/
 ws_uart::~ws_uart(void) {
-#ifdef USE_SW_UART
-  _swSerial = nullptr;
-#else
-  _hwSerial = nullptr;
-#endif
+  while (!_buses.empty())
+    releaseBus(_buses.back());
 }
 
 /*******************************************************************************/
 /*!
-    @brief    Initializes a UART bus.
+    @brief    Finds the UART bus on a device's pins, initializing it if it
+              is not in use yet.
     @param    msgUARTRequest
               Pointer to a UARTDeviceAttachRequest message.
+    @returns  The UART bus, or nullptr if every UART is in use.
 */
 /*******************************************************************************/
-void ws_uart::initUARTBus(
+ws_uart_bus *ws_uart::initUARTBus(
     wippersnapper_uart_v1_UARTDeviceAttachRequest *msgUARTRequest) {
   // Parse bus_info
   int32_t baud = msgUARTRequest->bus_info.baudrate;
@@ -43,109 +42,123 @@ void ws_uart::initUARTBus(
   int32_t tx = atoi(msgUARTRequest->bus_info.pin_tx + 1);
   bool invert = msgUARTRequest->bus_info.is_invert;
 
+  // Have we previously initialized a UART bus on these pins?
+  for (ws_uart_bus *bus : _buses) {
+    if (bus->rx == rx && bus->tx == tx)
+      return bus;
+  }
+  if (_buses.size() >= WS_UART_MAX_BUSES) {
+    WS_DEBUG_PRINTLN("[ERROR, UART]: No free UART for another bus!");
+    return nullptr;
+  }
+
+  ws_uart_bus *bus = new ws_uart_bus();
+  bus->rx = rx;
+  bus->tx = tx;
 // Initialize and begin UART bus depending if the platform supports either HW
 // UART or SW UART
 #ifdef USE_SW_UART
 #ifndef ARDUINO_ARCH_RP2040
-  _swSerial = new SoftwareSerial(rx, tx, invert);
+  bus->swSerial = new SoftwareSerial(rx, tx, invert);
 #else // RP2040 SoftwareSerial emulation does not support inverted mode
-  _swSerial = new SoftwareSerial(rx, tx);
+  bus->swSerial = new SoftwareSerial(rx, tx);
 #endif
-  _swSerial->begin(baud);
+  bus->swSerial->begin(baud);
 #else
 #ifndef ARDUINO_ARCH_SAMD
-  _hwSerial = new HardwareSerial(1);
-  _hwSerial->begin(baud, SERIAL_8N1, rx, tx, invert);
+  // Take the lowest hardware UART no other bus uses, UART0 is the console
+  uint32_t uartsInUse = 1UL;
+  for (ws_uart_bus *other : _buses)
+    uartsInUse |= 1UL << other->uartNum;
+  bus->uartNum = 1;
+  while (uartsInUse & (1UL << bus->uartNum))
+    bus->uartNum++;
+  bus->hwSerial = new HardwareSerial(bus->uartNum);
+  bus->hwSerial->begin(baud, SERIAL_8N1, rx, tx, invert);
 #else
-  _hwSerial = &Serial1;
-  _hwSerial->begin(baud);
+  bus->uartNum = 1;
+  bus->hwSerial = &Serial1;
+  bus->hwSerial->begin(baud);
 #endif
 #endif
-  _is_bus_initialized = true;
+  _buses.push_back(bus);
+  WS_DEBUG_PRINT("[INFO, UART]: Initialized UART bus on RX ");
+  WS_DEBUG_PRINT(rx);
+  WS_DEBUG_PRINT(", TX ");
+  WS_DEBUG_PRINTLN(tx);
+  return bus;
 }
 
-#ifdef USE_SW_UART
 /*******************************************************************************/
 /*!
-    @brief    Initializes the PM25AQI device driver using SoftwareSerial.
-    @param    swSerial
-              Pointer to a SoftwareSerial instance.
-    @param    pollingInterval
-              Polling interval for the pms5003 device.
-    @param    device_id
-              Which PM25 device are we communicating with?
-    @returns  True if pms5003 driver was successfully initialized, False
-   otherwise.
+    @brief    Stops a UART bus, frees its devices and releases its pins.
+    @param    bus
+              UART bus to release.
 */
 /*******************************************************************************/
-bool ws_uart::initUARTDevicePM25AQI(SoftwareSerial *swSerial,
-                                    int32_t pollingInterval,
-                                    const char *device_id) {
-  if (_pm25aqi != nullptr) {
-    WS_DEBUG_PRINTLN(
-        "[ERROR, UART]: pms5003 driver already initialized on bus!");
-    return false;
-  }
-  WS_DEBUG_PRINTLN("[INFO, UART]: Initializing PM25AQI driver...");
-  _pm25aqi = new ws_uart_drv_pm25aqi(swSerial, pollingInterval);
-  _pm25aqi->setDriverID(
-      device_id); // Since the AdafruitPM25 driver works with both Adafruit PM
-                  // sensor and PM1006, we need to set the driver ID
-  if (!_pm25aqi->begin()) {
-    WS_DEBUG_PRINTLN("[ERROR, UART]: PM25 driver initialization failed!");
-    return false;
+void ws_uart::releaseBus(ws_uart_bus *bus) {
+  for (ws_uart_drv *ptrUARTDriver : bus->drivers)
+    delete ptrUARTDriver;
+#ifdef USE_SW_UART
+  bus->swSerial->end();
+  delete bus->swSerial;
+#else
+  bus->hwSerial->end();
+#ifndef ARDUINO_ARCH_SAMD
+  delete bus->hwSerial;
+#endif
+#endif
+  for (size_t i = 0; i < _buses.size(); i++) {
+    if (_buses[i] == bus) {
+      _buses.erase(_buses.begin() + i);
+      break;
+    }
   }
-  _pm25aqi->set_mqtt_client(WS._mqtt, WS._topic_signal_uart_device);
-  uartDrivers.push_back(_pm25aqi);
-  return true;
+  delete bus;
 }
-#else
+
 /*******************************************************************************/
 /*!
-    @brief    Initializes the pms5003 device driver using HardwareSerial.
-    @param    hwSerial
-              Pointer to a HardwareSerial instance.
+    @brief    Initializes the driver for a UART device described by a
+              frame description.
+    @param    bus
+              UART bus the device is attached to.
     @param    pollingInterval
-              Polling interval for the pms5003 device.
+              Polling interval for the device.
+    @param    frame
+              Description of the frames the device sends.
     @param    device_id
-              Which PM25 device are we communicating with?
-    @returns  True if pms5003 driver was successfully initialized, False
-   otherwise.
+              Which UART device are we communicating with?
+    @returns  True if the driver was successfully initialized, False
+              otherwise.
 */
 /*******************************************************************************/
-bool ws_uart::initUARTDevicePM25AQI(HardwareSerial *hwSerial,
-                                    int32_t pollingInterval,
-                                    const char *device_id) {
-  if (_pm25aqi != nullptr) {
-    WS_DEBUG_PRINTLN(
-        "[ERROR, UART]: pms5003 driver already initialized on bus!");
-    return false;
-  }
-  _pm25aqi = new ws_uart_drv_pm25aqi(hwSerial, pollingInterval);
-  _pm25aqi->setDriverID(
-      device_id); // Since the AdafruitPM25 driver works with both Adafruit PM
-                  // sensor and PM1006, we need to set the driver ID
-  if (!_pm25aqi->begin()) {
-    WS_DEBUG_PRINTLN("[ERROR, UART]: PM25 driver initialization failed!");
+bool ws_uart::initUARTDeviceFrame(ws_uart_bus *bus, int32_t pollingInterval,
+                                  const ws_uart_frame_t *frame,
+                                  const char *device_id) {
+  WS_DEBUG_PRINT("[INFO, UART]: Initializing driver for ");
+  WS_DEBUG_PRINTLN(device_id);
+#ifdef USE_SW_UART
+  ws_uart_drv_frame *drv =
+      new ws_uart_drv_frame(bus->swSerial, pollingInterval, frame);
+#else
+  ws_uart_drv_frame *drv =
+      new ws_uart_drv_frame(bus->hwSerial, pollingInterval, frame);
+#endif
+  drv->setDriverID(device_id);
+  if (!drv->begin()) {
+    WS_DEBUG_PRINTLN("[ERROR, UART]: UART driver initialization failed!");
+    delete drv;
     return false;
   }
-  _pm25aqi->set_mqtt_client(WS._mqtt, WS._topic_signal_uart_device);
-  uartDrivers.push_back(_pm25aqi);
+  drv->set_mqtt_client(WS._mqtt, WS._topic_signal_uart_device);
+  bus->drivers.push_back(drv);
   return true;
 }
-#endif
-
-/*******************************************************************************/
-/*!
-    @brief    Checks if the UART bus has been initialized.
-    @returns  True if the UART bus is initialized, False otherwise.
-*/
-/*******************************************************************************/
-bool ws_uart::isUARTBusInitialized() { return _is_bus_initialized; }
 
 /*******************************************************************************/
 /*!
-    @brief    Initializes a device on the UART bus.
+    @brief    Initializes a device on the UART bus specified by its pins.
     @param    msgUARTRequest
               Pointer to a UARTDeviceAttachRequest message.
     @returns  True if UART driver was successfully initialized.
@@ -158,56 +171,63 @@ bool ws_uart::initUARTDevice(
     return false;
   }
 
-  // Do we already have a device with this ID?
-  for (ws_uart_drv *ptrUARTDriver : uartDrivers) {
-    if (strcmp(ptrUARTDriver->getDriverID(), msgUARTRequest->device_id) == 0) {
-      deinitUARTDevice(
-          msgUARTRequest->device_id); // Deinit the device and free resources
-    }
-  }
-
   // Check which device type we are initializing
-  if (strcmp(msgUARTRequest->device_id, "pms5003") == 0 ||
-      strcmp(msgUARTRequest->device_id, "pm1006") == 0) {
-// Attempt to initialize Adafruit_PM25 driver with either SW or HW UART
-#ifdef USE_SW_UART
-    if (!initUARTDevicePM25AQI(_swSerial, msgUARTRequest->polling_interval,
-                               msgUARTRequest->device_id))
-      return false;
-#else
-    if (!initUARTDevicePM25AQI(_hwSerial, msgUARTRequest->polling_interval,
-                               msgUARTRequest->device_id))
-      return false;
-#endif
-    WS_DEBUG_PRINTLN("[INFO, UART]: PM25 UART driver initialized!");
-  } else {
+  const ws_uart_frame_t *frame = ws_uart_find_frame(msgUARTRequest->device_id);
+  if (frame == nullptr) {
     WS_DEBUG_PRINTLN("[ERROR, UART]: Could not find UART device type");
     return false;
   }
-  return true;
+
+  // Do we already have a device with this ID?
+  deinitUARTDevice(
+      msgUARTRequest->device_id); // Deinit the device and free resources
+
+  ws_uart_bus *bus = initUARTBus(msgUARTRequest);
+  if (bus == nullptr)
+    return false;
+  // Each driver buffers what it reads off the UART, so a second driver on
+  // the bus would take bytes meant for the first
+  if (!bus->drivers.empty()) {
+    WS_DEBUG_PRINTLN("[ERROR, UART]: UART bus already has a device!");
+    return false;
+  }
+
+  bool did_init = initUARTDeviceFrame(bus, msgUARTRequest->polling_interval,
+                                      frame, msgUARTRequest->device_id);
+  if (did_init)
+    WS_DEBUG_PRINTLN("[INFO, UART]: UART driver initialized!");
+  // Don't hold on to a UART no device is using
+  if (bus->drivers.empty())
+    releaseBus(bus);
+  return did_init;
 }
 
 /*******************************************************************************/
 /*!
-    @brief    Deinitializes a device from the UART bus and frees its memory.
+    @brief    Deinitializes a device from its UART bus and frees its memory.
+              A bus left without devices is released.
     @param    device_id
               Device identifier of the UART device to deinitialize.
 */
 /*******************************************************************************/
 void ws_uart::deinitUARTDevice(const char *device_id) {
-  // Start an iterator on the first driver within the uartDrivers vector
-  std::vector<ws_uart_drv *>::iterator iter = uartDrivers.begin();
-  // Iterate through the vector
-  while (iter != uartDrivers.end()) {
-    ws_uart_drv *ptrUARTDriver = *iter; // Get a pointer to the driver
-    if (strcmp(ptrUARTDriver->getDriverID(), device_id) == 0) {
-      if (ptrUARTDriver == _pm25aqi) {
-        _pm25aqi = nullptr;
+  for (ws_uart_bus *bus : _buses) {
+    // Start an iterator on the first driver within the bus's drivers vector
+    std::vector<ws_uart_drv *>::iterator iter = bus->drivers.begin();
+    // Iterate through the vector
+    while (iter != bus->drivers.end()) {
+      ws_uart_drv *ptrUARTDriver = *iter; // Get a pointer to the driver
+      if (strcmp(ptrUARTDriver->getDriverID(), device_id) == 0) {
+        delete ptrUARTDriver;
+        // Erase the driver from the vector of drivers
+        iter = bus->drivers.erase(iter);
+      } else {
+        ++iter;
       }
-      // Erase the driver from the vector of drivers
-      iter = uartDrivers.erase(iter);
-    } else {
-      ++iter;
+    }
+    if (bus->drivers.empty()) {
+      releaseBus(bus);
+      return; // a device ID is only attached once
     }
   }
 }
@@ -227,17 +247,46 @@ void ws_uart::detachUARTDevice(
 
 /*******************************************************************************/
 /*!
-    @brief    Polls the UART driver for new data and sends it to IO.
+    @brief    Parses the bytes each UART driver has received and sends
+              new data to IO at the driver's polling interval.
 */
 /*******************************************************************************/
 void ws_uart::update() {
-  for (ws_uart_drv *ptrUARTDriver : uartDrivers) {
-    if (ptrUARTDriver->isReady()) {
-      // Attempt to poll the UART driver for new data
-      if (ptrUARTDriver->read_data()) {
-        // Send UART driver's data to IO
-        ptrUARTDriver->send_data();
+  for (ws_uart_bus *bus : _buses) {
+    for (ws_uart_drv *ptrUARTDriver : bus->drivers) {
+      // Consume whatever the UART has received, without waiting for more
+      ptrUARTDriver->serviceRx();
+      if (ptrUARTDriver->isReady()) {
+        // Attempt to poll the UART driver for new data
+        if (ptrUARTDriver->read_data()) {
+          // Send UART driver's data to IO
+          ptrUARTDriver->send_data();
+        }
       }
     }
   }
 }
+
+/*******************************************************************************/
+/*!
+    @brief    Finds when update() next has a UART device to poll, or
+              received bytes to move off the UART.
+    @param    curTime
+              Current time, from millis().
+    @returns  Deadline as a millis() timestamp.
+*/
+/*******************************************************************************/
+unsigned long ws_uart::getNextUpdateTime(unsigned long curTime) {
+  unsigned long nextTime = curTime + WS_SCHEDULER_IDLE_MS;
+  if (!_buses.empty())
+    nextTime = curTime + WS_UART_RX_SERVICE_MS;
+  for (ws_uart_bus *bus : _buses) {
+    for (ws_uart_drv *ptrUARTDriver : bus->drivers) {
+      // a due device waiting on its next frame is checked at the service rate
+      unsigned long pollTime = ptrUARTDriver->getNextPollTime();
+      if ((long)(pollTime - curTime) > 0)
+        nextTime = ws_scheduler::earliest(nextTime, pollTime);
+    }
+  }
+  return nextTime;
+}
@@ -18,12 +18,44 @@
 
 #include "Wippersnapper.h"
 #include "drivers/ws_uart_drv.h"
-#include "drivers/ws_uart_drv_pm25aqi.h"
+#include "drivers/ws_uart_drv_frame.h"
+
+#ifndef WS_UART_MAX_BUSES
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/soc_caps.h"
+#if defined(SOC_UART_HP_NUM)
+#define WS_UART_MAX_BUSES                                                      \
+  (SOC_UART_HP_NUM - 1) ///< Hardware UARTs, less UART0 for the console
+#else
+#define WS_UART_MAX_BUSES                                                      \
+  (SOC_UART_NUM - 1) ///< Hardware UARTs, less UART0 for the console
+#endif
+#elif defined(USE_SW_UART)
+#define WS_UART_MAX_BUSES 2 ///< SoftwareSerial buses, each costs CPU time
+#elif defined(WS_NATIVE)
+#define WS_UART_MAX_BUSES 2 ///< Simulated hardware UARTs
+#else
+#define WS_UART_MAX_BUSES 1 ///< Serial1
+#endif
+#endif
+
+/** UART bus, keyed by its pins, and the devices attached to it */
+struct ws_uart_bus {
+  int32_t rx; ///< Bus RX pin
+  int32_t tx; ///< Bus TX pin
+#ifdef USE_SW_UART
+  SoftwareSerial *swSerial; ///< SoftwareSerial instance
+#else
+  HardwareSerial *hwSerial; ///< HardwareSerial instance
+  uint8_t uartNum;          ///< Hardware UART peripheral number
+#endif
+  std::vector<ws_uart_drv *> drivers; ///< Device on the bus, at most one
+};
 
 /**************************************************************************/
 /*!
     @brief  Class that provides an interface between WipperSnapper's app
-            and the device's UART bus.
+            and the device's UART buses.
 */
 /**************************************************************************/
 class ws_uart {
@@ -31,34 +63,27 @@ public:
   ws_uart(){};
   ~ws_uart(void);
 
-  void
+  ws_uart_bus *
   initUARTBus(wippersnapper_uart_v1_UARTDeviceAttachRequest
-                  *msgUARTRequest); ///< Initializes the UART bus, called once
+                  *msgUARTRequest); ///< Finds or initializes a UART bus
   bool initUARTDevice(wippersnapper_uart_v1_UARTDeviceAttachRequest
                           *msgUARTRequest); ///< Initializes a UART driver.
-  bool isUARTBusInitialized(); ///< Returns true if the UART bus is initialized
   void detachUARTDevice(
       wippersnapper_uart_v1_UARTDeviceDetachRequest
-          *msgUARTDetachReq); ///< Detaches a UART device from the UART bus
+          *msgUARTDetachReq); ///< Detaches a UART device from its UART bus
   void deinitUARTDevice(const char *device_id);
   void update(); ///< Updates the UART device at every polling interval, must be
                  ///< called by main app.
-#ifdef USE_SW_UART
-  bool initUARTDevicePM25AQI(SoftwareSerial *swSerial, int32_t pollingInterval,
-                             const char *device_id);
-#else
-  bool initUARTDevicePM25AQI(HardwareSerial *hwSerial, int32_t pollingInterval,
-                             const char *device_id);
-#endif
+  unsigned long getNextUpdateTime(
+      unsigned long curTime); ///< Returns when a UART device is next due
+  bool initUARTDeviceFrame(ws_uart_bus *bus, int32_t pollingInterval,
+                           const ws_uart_frame_t *frame,
+                           const char *device_id);
+
 private:
-#ifdef USE_SW_UART
-  SoftwareSerial *_swSerial = nullptr; ///< SoftwareSerial instance
-#else
-  HardwareSerial *_hwSerial = nullptr; ///< HardwareSerial instance
-#endif
-  bool _is_bus_initialized = false;        ///< True if UART bus is initialized
-  std::vector<ws_uart_drv *> uartDrivers;  ///< Vector of UART drivers
-  ws_uart_drv_pm25aqi *_pm25aqi = nullptr; ///< Pointer to a PM25 AQI device
+  void releaseBus(ws_uart_bus *bus);
+
+  std::vector<ws_uart_bus *> _buses; ///< UART buses in use
 };
 
 #endif // WS_UART_H
\ No newline at end of file
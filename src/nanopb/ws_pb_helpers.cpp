@@ -58,4 +58,28 @@ bool ws_pb_encode(pb_ostream_t *stream, const pb_msgdesc_t *fields,
     WS_DEBUG_PRINTLN(PB_GET_ERROR(stream));
   }
   return status;
+}
+
+// *****************************************************************************
+/*!
+    @brief    Encodes a protobuf message into a buffer in a single pass and
+              prints any error.
+    @param    buffer
+              The buffer to encode into.
+    @param    bufferSize
+              The size of buffer, in bytes.
+    @param    fields
+              The protobuf message fields.
+    @param    src_struct
+              The source struct to encode from.
+    @return   Number of bytes written to buffer, 0 if encode failed.
+!*/
+// *****************************************************************************
+size_t ws_pb_encode_to_buffer(uint8_t *buffer, size_t bufferSize,
+                              const pb_msgdesc_t *fields,
+                              const void *src_struct) {
+  pb_ostream_t stream = pb_ostream_from_buffer(buffer, bufferSize);
+  if (!ws_pb_encode(&stream, fields, src_struct))
+    return 0;
+  return stream.bytes_written;
 }
\ No newline at end of file
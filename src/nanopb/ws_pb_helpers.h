@@ -24,5 +24,9 @@ bool ws_pb_decode(pb_istream_t *stream, const pb_msgdesc_t *fields,
 
 bool ws_pb_encode(pb_ostream_t *stream, const pb_msgdesc_t *fields,
                          const void *src_struct);
+
+size_t ws_pb_encode_to_buffer(uint8_t *buffer, size_t bufferSize,
+                              const pb_msgdesc_t *fields,
+                              const void *src_struct);
                          
 #endif // WS_PB_ENCODE_H
\ No newline at end of file
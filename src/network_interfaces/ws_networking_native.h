@@ -0,0 +1,198 @@
+/*!
+ * @file ws_networking_native.h
+ *
+ * Network interface for running Adafruit IO WipperSnapper on a Linux host
+ * (the `native` PlatformIO environment). The WiFi station and the MQTT
+ * broker are both simulated in-process, see native/hal.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * Copyright (c) Adafruit Industries 2026.
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+
+#ifndef WS_NETWORKING_NATIVE_H
+#define WS_NETWORKING_NATIVE_H
+
+#ifdef WS_NATIVE
+#include "Wippersnapper.h"
+
+#include "Adafruit_MQTT.h"
+#include "Adafruit_MQTT_Client.h"
+#include "Arduino.h"
+#include "WiFi.h"
+#include "ws_native_broker.h"
+extern Wippersnapper WS;
+
+/****************************************************************************/
+/*!
+    @brief  Class for using the simulated host network interface.
+*/
+/****************************************************************************/
+class ws_networking_native : public Wippersnapper {
+
+public:
+  /**************************************************************************/
+  /*!
+  @brief  Initializes the WipperSnapper class for the host build.
+  */
+  /**************************************************************************/
+  ws_networking_native() : Wippersnapper() {
+    _ssid = 0;
+    _pass = 0;
+  }
+
+  /**************************************************************************/
+  /*!
+  @brief  Destructor for the host network interface.
+  */
+  /**************************************************************************/
+  ~ws_networking_native() {}
+
+  /********************************************************/
+  /*!
+  @brief  Sets the WiFi client's ssid and password.
+  @param  ssid
+            WiFi network's SSID.
+  @param  ssidPassword
+            WiFi network's password.
+  */
+  /********************************************************/
+  void set_ssid_pass(const char *ssid, const char *ssidPassword) {
+    _ssid = ssid;
+    _pass = ssidPassword;
+  }
+
+  /**********************************************************/
+  /*!
+  @brief  Sets the WiFi client's ssid and password.
+  */
+  /**********************************************************/
+  void set_ssid_pass() {
+    _ssid = WS._config.network.ssid;
+    _pass = WS._config.network.pass;
+  }
+
+  /****************************************************************/
+  /*!
+  @brief  Configures the device's Adafruit IO credentials from the
+          WS_AIO_USER, WS_AIO_KEY and WS_AIO_URL environment
+          variables, there is no filesystem to provision from.
+  */
+  /****************************************************************/
+  void set_user_key() {
+    const char *user = getenv("WS_AIO_USER");
+    const char *key = getenv("WS_AIO_KEY");
+    const char *url = getenv("WS_AIO_URL");
+    strncpy(WS._config.aio_user, user ? user : "native",
+            sizeof(WS._config.aio_user) - 1);
+    strncpy(WS._config.aio_key, key ? key : "native",
+            sizeof(WS._config.aio_key) - 1);
+    strncpy(WS._config.aio_url, url ? url : "localhost",
+            sizeof(WS._config.aio_url) - 1);
+    strncpy(WS._config.network.ssid, "native",
+            sizeof(WS._config.network.ssid) - 1);
+    WS._config.io_port = 1883;
+    WS._config.status_pixel_brightness = 0.2;
+  }
+
+  /***********************************************************/
+  /*!
+  @brief   Performs a scan of local WiFi networks.
+  @returns True, the simulated network is always in range.
+  */
+  /***********************************************************/
+  bool check_valid_ssid() { return WiFi.scanNetworks() > 0; }
+
+  /********************************************************/
+  /*!
+  @brief  Sets the host's unique client identifier.
+  */
+  /********************************************************/
+  void getMacAddr() {
+    uint8_t mac[6] = {0};
+    WiFi.macAddress(mac);
+    memcpy(WS._macAddr, mac, sizeof(mac));
+  }
+
+  /********************************************************/
+  /*!
+  @brief  Gets the current network RSSI value
+  @return int32_t RSSI value
+  */
+  /********************************************************/
+  int32_t getRSSI() { return WiFi.RSSI(); }
+
+  /********************************************************/
+  /*!
+  @brief  Initializes the MQTT client against the loopback
+          broker.
+  @param  clientID
+          MQTT client identifier
+  */
+  /********************************************************/
+  void setupMQTTClient(const char *clientID) {
+    WS._mqtt = new Adafruit_MQTT_Client(
+        &WS_NATIVE_BROKER, WS._config.aio_url, WS._config.io_port, clientID,
+        WS._config.aio_user, WS._config.aio_key);
+  }
+
+  /********************************************************/
+  /*!
+  @brief  Returns the network status of the host.
+  @return ws_status_t
+  */
+  /********************************************************/
+  ws_status_t networkStatus() {
+    switch (WiFi.status()) {
+    case WL_CONNECTED:
+      return WS_NET_CONNECTED;
+    case WL_CONNECT_FAILED:
+      return WS_NET_CONNECT_FAILED;
+    case WL_IDLE_STATUS:
+      return WS_IDLE;
+    default:
+      return WS_NET_DISCONNECTED;
+    }
+  }
+
+  /*******************************************************************/
+  /*!
+  @brief  Returns the type of network connection used by Wippersnapper
+  @return Native
+  */
+  /*******************************************************************/
+  const char *connectionType() { return "Native"; }
+
+protected:
+  const char *_ssid; ///< WiFi SSID
+  const char *_pass; ///< WiFi password
+
+  /**************************************************************************/
+  /*!
+  @brief  Establishes a connection with the simulated network.
+  */
+  /**************************************************************************/
+  void _connect() {
+    if (WiFi.status() == WL_CONNECTED)
+      return;
+    WiFi.begin(_ssid, _pass);
+    _status = (WiFi.status() == WL_CONNECTED) ? WS_NET_CONNECTED
+                                               : WS_NET_DISCONNECTED;
+    WS.feedWDT();
+  }
+
+  /**************************************************************************/
+  /*!
+      @brief  Disconnects from the simulated network.
+  */
+  /**************************************************************************/
+  void _disconnect() { WiFi.disconnect(); }
+};
+
+#endif // WS_NATIVE
+#endif // WS_NETWORKING_NATIVE_H
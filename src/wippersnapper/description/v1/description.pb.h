@@ -44,6 +44,9 @@ typedef struct _wippersnapper_description_v1_CreateDescriptionResponse {
     int32_t total_analog_pins;
     float reference_voltage;
     int32_t total_i2c_ports;
+    bool numeric_pin_events;
+    bool pin_event_batches;
+    bool ds18x20_sensor_addresses;
 } wippersnapper_description_v1_CreateDescriptionResponse;
 
 typedef struct _wippersnapper_description_v1_RegistrationComplete {
@@ -64,13 +67,13 @@ extern "C" {
 /* Initializer values for message structs */
 #define wippersnapper_description_v1_CreateDescriptionRequest_init_default {"", 0, 0, 0, ""}
 #define wippersnapper_description_v1_CreateDescriptionRequest_Version_init_default {0}
-#define wippersnapper_description_v1_CreateDescriptionResponse_init_default {_wippersnapper_description_v1_CreateDescriptionResponse_Response_MIN, 0, 0, 0, 0}
+#define wippersnapper_description_v1_CreateDescriptionResponse_init_default {_wippersnapper_description_v1_CreateDescriptionResponse_Response_MIN, 0, 0, 0, 0, 0, 0, 0}
 #define wippersnapper_description_v1_RegistrationComplete_init_default {0}
 #define wippersnapper_description_v1_GetDefinitionRequest_init_default {0}
 #define wippersnapper_description_v1_GetDefinitionResponse_init_default {0}
 #define wippersnapper_description_v1_CreateDescriptionRequest_init_zero {"", 0, 0, 0, ""}
 #define wippersnapper_description_v1_CreateDescriptionRequest_Version_init_zero {0}
-#define wippersnapper_description_v1_CreateDescriptionResponse_init_zero {_wippersnapper_description_v1_CreateDescriptionResponse_Response_MIN, 0, 0, 0, 0}
+#define wippersnapper_description_v1_CreateDescriptionResponse_init_zero {_wippersnapper_description_v1_CreateDescriptionResponse_Response_MIN, 0, 0, 0, 0, 0, 0, 0}
 #define wippersnapper_description_v1_RegistrationComplete_init_zero {0}
 #define wippersnapper_description_v1_GetDefinitionRequest_init_zero {0}
 #define wippersnapper_description_v1_GetDefinitionResponse_init_zero {0}
@@ -86,6 +89,9 @@ extern "C" {
 #define wippersnapper_description_v1_CreateDescriptionResponse_total_analog_pins_tag 3
 #define wippersnapper_description_v1_CreateDescriptionResponse_reference_voltage_tag 4
 #define wippersnapper_description_v1_CreateDescriptionResponse_total_i2c_ports_tag 5
+#define wippersnapper_description_v1_CreateDescriptionResponse_numeric_pin_events_tag 6
+#define wippersnapper_description_v1_CreateDescriptionResponse_pin_event_batches_tag 7
+#define wippersnapper_description_v1_CreateDescriptionResponse_ds18x20_sensor_addresses_tag 8
 #define wippersnapper_description_v1_RegistrationComplete_is_complete_tag 1
 
 /* Struct field encoding specification for nanopb */
@@ -108,7 +114,10 @@ X(a, STATIC,   SINGULAR, UENUM,    response,          1) \
 X(a, STATIC,   SINGULAR, INT32,    total_gpio_pins,   2) \
 X(a, STATIC,   SINGULAR, INT32,    total_analog_pins,   3) \
 X(a, STATIC,   SINGULAR, FLOAT,    reference_voltage,   4) \
-X(a, STATIC,   SINGULAR, INT32,    total_i2c_ports,   5)
+X(a, STATIC,   SINGULAR, INT32,    total_i2c_ports,   5) \
+X(a, STATIC,   SINGULAR, BOOL,     numeric_pin_events,   6) \
+X(a, STATIC,   SINGULAR, BOOL,     pin_event_batches,   7) \
+X(a, STATIC,   SINGULAR, BOOL,     ds18x20_sensor_addresses,   8)
 #define wippersnapper_description_v1_CreateDescriptionResponse_CALLBACK NULL
 #define wippersnapper_description_v1_CreateDescriptionResponse_DEFAULT NULL
 
@@ -145,7 +154,7 @@ extern const pb_msgdesc_t wippersnapper_description_v1_GetDefinitionResponse_msg
 /* Maximum encoded size of messages (where known) */
 #define wippersnapper_description_v1_CreateDescriptionRequest_size 119
 #define wippersnapper_description_v1_CreateDescriptionRequest_Version_size 0
-#define wippersnapper_description_v1_CreateDescriptionResponse_size 40
+#define wippersnapper_description_v1_CreateDescriptionResponse_size 46
 #define wippersnapper_description_v1_RegistrationComplete_size 2
 #define wippersnapper_description_v1_GetDefinitionRequest_size 0
 #define wippersnapper_description_v1_GetDefinitionResponse_size 0
@@ -20,6 +20,7 @@ typedef struct _wippersnapper_ds18x20_v1_Ds18x20DeviceEvent {
     char onewire_pin[5];
     pb_size_t sensor_event_count;
     wippersnapper_i2c_v1_SensorEvent sensor_event[2];
+    char sensor_address[17];
 } wippersnapper_ds18x20_v1_Ds18x20DeviceEvent;
 
 typedef struct _wippersnapper_ds18x20_v1_Ds18x20InitRequest {
@@ -32,6 +33,7 @@ typedef struct _wippersnapper_ds18x20_v1_Ds18x20InitRequest {
 typedef struct _wippersnapper_ds18x20_v1_Ds18x20InitResponse {
     bool is_initialized;
     char onewire_pin[5];
+    uint32_t sensor_count;
 } wippersnapper_ds18x20_v1_Ds18x20InitResponse;
 
 
@@ -41,23 +43,25 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_init_default {"", 0, 0, {wippersnapper_i2c_v1_I2CDeviceSensorProperties_init_default, wippersnapper_i2c_v1_I2CDeviceSensorProperties_init_default}}
-#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_init_default {0, ""}
+#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_init_default {0, "", 0}
 #define wippersnapper_ds18x20_v1_Ds18x20DeInitRequest_init_default {""}
-#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_init_default {"", 0, {wippersnapper_i2c_v1_SensorEvent_init_default, wippersnapper_i2c_v1_SensorEvent_init_default}}
+#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_init_default {"", 0, {wippersnapper_i2c_v1_SensorEvent_init_default, wippersnapper_i2c_v1_SensorEvent_init_default}, ""}
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_init_zero {"", 0, 0, {wippersnapper_i2c_v1_I2CDeviceSensorProperties_init_zero, wippersnapper_i2c_v1_I2CDeviceSensorProperties_init_zero}}
-#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_init_zero {0, ""}
+#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_init_zero {0, "", 0}
 #define wippersnapper_ds18x20_v1_Ds18x20DeInitRequest_init_zero {""}
-#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_init_zero {"", 0, {wippersnapper_i2c_v1_SensorEvent_init_zero, wippersnapper_i2c_v1_SensorEvent_init_zero}}
+#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_init_zero {"", 0, {wippersnapper_i2c_v1_SensorEvent_init_zero, wippersnapper_i2c_v1_SensorEvent_init_zero}, ""}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define wippersnapper_ds18x20_v1_Ds18x20DeInitRequest_onewire_pin_tag 1
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_onewire_pin_tag 1
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_sensor_event_tag 2
+#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_sensor_address_tag 3
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_onewire_pin_tag 1
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_sensor_resolution_tag 2
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_i2c_device_properties_tag 3
 #define wippersnapper_ds18x20_v1_Ds18x20InitResponse_is_initialized_tag 1
 #define wippersnapper_ds18x20_v1_Ds18x20InitResponse_onewire_pin_tag 2
+#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_sensor_count_tag 3
 
 /* Struct field encoding specification for nanopb */
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_FIELDLIST(X, a) \
@@ -70,7 +74,8 @@ X(a, STATIC,   REPEATED, MESSAGE,  i2c_device_properties,   3)
 
 #define wippersnapper_ds18x20_v1_Ds18x20InitResponse_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, BOOL,     is_initialized,    1) \
-X(a, STATIC,   SINGULAR, STRING,   onewire_pin,       2)
+X(a, STATIC,   SINGULAR, STRING,   onewire_pin,       2) \
+X(a, STATIC,   SINGULAR, UINT32,   sensor_count,      3)
 #define wippersnapper_ds18x20_v1_Ds18x20InitResponse_CALLBACK NULL
 #define wippersnapper_ds18x20_v1_Ds18x20InitResponse_DEFAULT NULL
 
@@ -81,7 +86,8 @@ X(a, STATIC,   SINGULAR, STRING,   onewire_pin,       1)
 
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, STRING,   onewire_pin,       1) \
-X(a, STATIC,   REPEATED, MESSAGE,  sensor_event,      2)
+X(a, STATIC,   REPEATED, MESSAGE,  sensor_event,      2) \
+X(a, STATIC,   SINGULAR, STRING,   sensor_address,    3)
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_CALLBACK NULL
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_DEFAULT NULL
 #define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_sensor_event_MSGTYPE wippersnapper_i2c_v1_SensorEvent
@@ -99,9 +105,9 @@ extern const pb_msgdesc_t wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_msg;
 
 /* Maximum encoded size of messages (where known) */
 #define wippersnapper_ds18x20_v1_Ds18x20InitRequest_size 37
-#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_size 8
+#define wippersnapper_ds18x20_v1_Ds18x20InitResponse_size 14
 #define wippersnapper_ds18x20_v1_Ds18x20DeInitRequest_size 6
-#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_size 24
+#define wippersnapper_ds18x20_v1_Ds18x20DeviceEvent_size 42
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -15,6 +15,9 @@ PB_BIND(wippersnapper_pin_v1_ConfigurePinRequest, wippersnapper_pin_v1_Configure
 PB_BIND(wippersnapper_pin_v1_PinEvent, wippersnapper_pin_v1_PinEvent, AUTO)
 
 
+PB_BIND(wippersnapper_pin_v1_PinEventValue, wippersnapper_pin_v1_PinEventValue, AUTO)
+
+
 PB_BIND(wippersnapper_pin_v1_ConfigureReferenceVoltage, wippersnapper_pin_v1_ConfigureReferenceVoltage, AUTO)
 
 
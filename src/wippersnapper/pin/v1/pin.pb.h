@@ -65,6 +65,7 @@ typedef struct _wippersnapper_pin_v1_PWMPinEvents {
 
 typedef struct _wippersnapper_pin_v1_PinEvents {
     pb_callback_t list;
+    pb_callback_t values;
 } wippersnapper_pin_v1_PinEvents;
 
 typedef struct _wippersnapper_pin_v1_ConfigurePinRequest {
@@ -87,6 +88,16 @@ typedef struct _wippersnapper_pin_v1_PinEvent {
     char pin_value[12];
 } wippersnapper_pin_v1_PinEvent;
 
+typedef struct _wippersnapper_pin_v1_PinEventValue {
+    uint32_t pin;
+    wippersnapper_pin_v1_Mode mode;
+    pb_size_t which_value;
+    union {
+        int32_t int_value;
+        float float_value;
+    } value;
+} wippersnapper_pin_v1_PinEventValue;
+
 
 /* Helper constants for enums */
 #define _wippersnapper_pin_v1_Mode_MIN wippersnapper_pin_v1_Mode_MODE_UNSPECIFIED
@@ -118,8 +129,9 @@ extern "C" {
 #define wippersnapper_pin_v1_ConfigurePinRequests_init_default {{{NULL}, NULL}}
 #define wippersnapper_pin_v1_ConfigurePinRequest_init_default {"", _wippersnapper_pin_v1_Mode_MIN, _wippersnapper_pin_v1_ConfigurePinRequest_Direction_MIN, _wippersnapper_pin_v1_ConfigurePinRequest_Pull_MIN, 0, _wippersnapper_pin_v1_ConfigurePinRequest_RequestType_MIN, 0, _wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_MIN}
 #define wippersnapper_pin_v1_PinEvent_init_default {"", ""}
+#define wippersnapper_pin_v1_PinEventValue_init_default {0, _wippersnapper_pin_v1_Mode_MIN, 0, {0}}
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_init_default {0}
-#define wippersnapper_pin_v1_PinEvents_init_default {{{NULL}, NULL}}
+#define wippersnapper_pin_v1_PinEvents_init_default {{{NULL}, NULL}, {{NULL}, NULL}}
 #define wippersnapper_pin_v1_ConfigurePWMPinRequest_init_default {0}
 #define wippersnapper_pin_v1_ConfigurePWMPinRequests_init_default {0}
 #define wippersnapper_pin_v1_PWMPinEvent_init_default {0}
@@ -127,8 +139,9 @@ extern "C" {
 #define wippersnapper_pin_v1_ConfigurePinRequests_init_zero {{{NULL}, NULL}}
 #define wippersnapper_pin_v1_ConfigurePinRequest_init_zero {"", _wippersnapper_pin_v1_Mode_MIN, _wippersnapper_pin_v1_ConfigurePinRequest_Direction_MIN, _wippersnapper_pin_v1_ConfigurePinRequest_Pull_MIN, 0, _wippersnapper_pin_v1_ConfigurePinRequest_RequestType_MIN, 0, _wippersnapper_pin_v1_ConfigurePinRequest_AnalogReadMode_MIN}
 #define wippersnapper_pin_v1_PinEvent_init_zero  {"", ""}
+#define wippersnapper_pin_v1_PinEventValue_init_zero {0, _wippersnapper_pin_v1_Mode_MIN, 0, {0}}
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_init_zero {0}
-#define wippersnapper_pin_v1_PinEvents_init_zero {{{NULL}, NULL}}
+#define wippersnapper_pin_v1_PinEvents_init_zero {{{NULL}, NULL}, {{NULL}, NULL}}
 #define wippersnapper_pin_v1_ConfigurePWMPinRequest_init_zero {0}
 #define wippersnapper_pin_v1_ConfigurePWMPinRequests_init_zero {0}
 #define wippersnapper_pin_v1_PWMPinEvent_init_zero {0}
@@ -137,6 +150,7 @@ extern "C" {
 /* Field tags (for use in manual encoding/decoding) */
 #define wippersnapper_pin_v1_ConfigurePinRequests_list_tag 1
 #define wippersnapper_pin_v1_PinEvents_list_tag  1
+#define wippersnapper_pin_v1_PinEvents_values_tag 2
 #define wippersnapper_pin_v1_ConfigurePinRequest_pin_name_tag 1
 #define wippersnapper_pin_v1_ConfigurePinRequest_mode_tag 2
 #define wippersnapper_pin_v1_ConfigurePinRequest_direction_tag 3
@@ -148,6 +162,10 @@ extern "C" {
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_reference_voltage_tag 1
 #define wippersnapper_pin_v1_PinEvent_pin_name_tag 1
 #define wippersnapper_pin_v1_PinEvent_pin_value_tag 2
+#define wippersnapper_pin_v1_PinEventValue_pin_tag 1
+#define wippersnapper_pin_v1_PinEventValue_mode_tag 2
+#define wippersnapper_pin_v1_PinEventValue_int_value_tag 3
+#define wippersnapper_pin_v1_PinEventValue_float_value_tag 4
 
 /* Struct field encoding specification for nanopb */
 #define wippersnapper_pin_v1_ConfigurePinRequests_FIELDLIST(X, a) \
@@ -174,16 +192,26 @@ X(a, STATIC,   SINGULAR, STRING,   pin_value,         2)
 #define wippersnapper_pin_v1_PinEvent_CALLBACK NULL
 #define wippersnapper_pin_v1_PinEvent_DEFAULT NULL
 
+#define wippersnapper_pin_v1_PinEventValue_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   pin,               1) \
+X(a, STATIC,   SINGULAR, UENUM,    mode,              2) \
+X(a, STATIC,   ONEOF,    SINT32,   (value,int_value,value.int_value),   3) \
+X(a, STATIC,   ONEOF,    FLOAT,    (value,float_value,value.float_value),   4)
+#define wippersnapper_pin_v1_PinEventValue_CALLBACK NULL
+#define wippersnapper_pin_v1_PinEventValue_DEFAULT NULL
+
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, FLOAT,    reference_voltage,   1)
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_CALLBACK NULL
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_DEFAULT NULL
 
 #define wippersnapper_pin_v1_PinEvents_FIELDLIST(X, a) \
-X(a, CALLBACK, REPEATED, MESSAGE,  list,              1)
+X(a, CALLBACK, REPEATED, MESSAGE,  list,              1) \
+X(a, CALLBACK, REPEATED, MESSAGE,  values,            2)
 #define wippersnapper_pin_v1_PinEvents_CALLBACK pb_default_field_callback
 #define wippersnapper_pin_v1_PinEvents_DEFAULT NULL
 #define wippersnapper_pin_v1_PinEvents_list_MSGTYPE wippersnapper_pin_v1_PinEvent
+#define wippersnapper_pin_v1_PinEvents_values_MSGTYPE wippersnapper_pin_v1_PinEventValue
 
 #define wippersnapper_pin_v1_ConfigurePWMPinRequest_FIELDLIST(X, a) \
 
@@ -208,6 +236,7 @@ X(a, CALLBACK, REPEATED, MESSAGE,  list,              1)
 extern const pb_msgdesc_t wippersnapper_pin_v1_ConfigurePinRequests_msg;
 extern const pb_msgdesc_t wippersnapper_pin_v1_ConfigurePinRequest_msg;
 extern const pb_msgdesc_t wippersnapper_pin_v1_PinEvent_msg;
+extern const pb_msgdesc_t wippersnapper_pin_v1_PinEventValue_msg;
 extern const pb_msgdesc_t wippersnapper_pin_v1_ConfigureReferenceVoltage_msg;
 extern const pb_msgdesc_t wippersnapper_pin_v1_PinEvents_msg;
 extern const pb_msgdesc_t wippersnapper_pin_v1_ConfigurePWMPinRequest_msg;
@@ -219,6 +248,7 @@ extern const pb_msgdesc_t wippersnapper_pin_v1_PWMPinEvents_msg;
 #define wippersnapper_pin_v1_ConfigurePinRequests_fields &wippersnapper_pin_v1_ConfigurePinRequests_msg
 #define wippersnapper_pin_v1_ConfigurePinRequest_fields &wippersnapper_pin_v1_ConfigurePinRequest_msg
 #define wippersnapper_pin_v1_PinEvent_fields &wippersnapper_pin_v1_PinEvent_msg
+#define wippersnapper_pin_v1_PinEventValue_fields &wippersnapper_pin_v1_PinEventValue_msg
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_fields &wippersnapper_pin_v1_ConfigureReferenceVoltage_msg
 #define wippersnapper_pin_v1_PinEvents_fields &wippersnapper_pin_v1_PinEvents_msg
 #define wippersnapper_pin_v1_ConfigurePWMPinRequest_fields &wippersnapper_pin_v1_ConfigurePWMPinRequest_msg
@@ -230,6 +260,7 @@ extern const pb_msgdesc_t wippersnapper_pin_v1_PWMPinEvents_msg;
 /* wippersnapper_pin_v1_ConfigurePinRequests_size depends on runtime parameters */
 #define wippersnapper_pin_v1_ConfigurePinRequest_size 26
 #define wippersnapper_pin_v1_PinEvent_size       19
+#define wippersnapper_pin_v1_PinEventValue_size  14
 #define wippersnapper_pin_v1_ConfigureReferenceVoltage_size 5
 /* wippersnapper_pin_v1_PinEvents_size depends on runtime parameters */
 #define wippersnapper_pin_v1_ConfigurePWMPinRequest_size 0
@@ -18,6 +18,9 @@ PB_BIND(wippersnapper_pixels_v1_PixelsDeleteRequest, wippersnapper_pixels_v1_Pix
 PB_BIND(wippersnapper_pixels_v1_PixelsWriteRequest, wippersnapper_pixels_v1_PixelsWriteRequest, AUTO)
 
 
+PB_BIND(wippersnapper_pixels_v1_PixelsAnimateRequest, wippersnapper_pixels_v1_PixelsAnimateRequest, AUTO)
+
+
 
 
 
@@ -29,6 +29,15 @@ typedef enum _wippersnapper_pixels_v1_PixelsOrder {
     wippersnapper_pixels_v1_PixelsOrder_PIXELS_ORDER_BGR = 8
 } wippersnapper_pixels_v1_PixelsOrder;
 
+typedef enum _wippersnapper_pixels_v1_PixelsEffect {
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED = 0,
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_FADE = 1,
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_CHASE = 2,
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_RAINBOW = 3,
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_BREATHE = 4,
+    wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_GRADIENT = 5
+} wippersnapper_pixels_v1_PixelsEffect;
+
 /* Struct definitions */
 typedef struct _wippersnapper_pixels_v1_PixelsCreateRequest {
     wippersnapper_pixels_v1_PixelsType pixels_type;
@@ -56,6 +65,16 @@ typedef struct _wippersnapper_pixels_v1_PixelsWriteRequest {
     uint32_t pixels_color;
 } wippersnapper_pixels_v1_PixelsWriteRequest;
 
+typedef struct _wippersnapper_pixels_v1_PixelsAnimateRequest {
+    wippersnapper_pixels_v1_PixelsType pixels_type;
+    char pixels_pin_data[6];
+    wippersnapper_pixels_v1_PixelsEffect pixels_effect;
+    uint32_t pixels_color;
+    uint32_t pixels_color_secondary;
+    uint32_t pixels_period_ms;
+    uint32_t pixels_width;
+} wippersnapper_pixels_v1_PixelsAnimateRequest;
+
 
 /* Helper constants for enums */
 #define _wippersnapper_pixels_v1_PixelsType_MIN wippersnapper_pixels_v1_PixelsType_PIXELS_TYPE_UNSPECIFIED
@@ -66,6 +85,10 @@ typedef struct _wippersnapper_pixels_v1_PixelsWriteRequest {
 #define _wippersnapper_pixels_v1_PixelsOrder_MAX wippersnapper_pixels_v1_PixelsOrder_PIXELS_ORDER_BGR
 #define _wippersnapper_pixels_v1_PixelsOrder_ARRAYSIZE ((wippersnapper_pixels_v1_PixelsOrder)(wippersnapper_pixels_v1_PixelsOrder_PIXELS_ORDER_BGR+1))
 
+#define _wippersnapper_pixels_v1_PixelsEffect_MIN wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_UNSPECIFIED
+#define _wippersnapper_pixels_v1_PixelsEffect_MAX wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_GRADIENT
+#define _wippersnapper_pixels_v1_PixelsEffect_ARRAYSIZE ((wippersnapper_pixels_v1_PixelsEffect)(wippersnapper_pixels_v1_PixelsEffect_PIXELS_EFFECT_GRADIENT+1))
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -76,10 +99,12 @@ extern "C" {
 #define wippersnapper_pixels_v1_PixelsCreateResponse_init_default {0, ""}
 #define wippersnapper_pixels_v1_PixelsDeleteRequest_init_default {_wippersnapper_pixels_v1_PixelsType_MIN, ""}
 #define wippersnapper_pixels_v1_PixelsWriteRequest_init_default {_wippersnapper_pixels_v1_PixelsType_MIN, "", 0}
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_init_default {_wippersnapper_pixels_v1_PixelsType_MIN, "", _wippersnapper_pixels_v1_PixelsEffect_MIN, 0, 0, 0, 0}
 #define wippersnapper_pixels_v1_PixelsCreateRequest_init_zero {_wippersnapper_pixels_v1_PixelsType_MIN, 0, _wippersnapper_pixels_v1_PixelsOrder_MIN, 0, "", "", ""}
 #define wippersnapper_pixels_v1_PixelsCreateResponse_init_zero {0, ""}
 #define wippersnapper_pixels_v1_PixelsDeleteRequest_init_zero {_wippersnapper_pixels_v1_PixelsType_MIN, ""}
 #define wippersnapper_pixels_v1_PixelsWriteRequest_init_zero {_wippersnapper_pixels_v1_PixelsType_MIN, "", 0}
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_init_zero {_wippersnapper_pixels_v1_PixelsType_MIN, "", _wippersnapper_pixels_v1_PixelsEffect_MIN, 0, 0, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define wippersnapper_pixels_v1_PixelsCreateRequest_pixels_type_tag 1
@@ -96,6 +121,13 @@ extern "C" {
 #define wippersnapper_pixels_v1_PixelsWriteRequest_pixels_type_tag 1
 #define wippersnapper_pixels_v1_PixelsWriteRequest_pixels_pin_data_tag 2
 #define wippersnapper_pixels_v1_PixelsWriteRequest_pixels_color_tag 3
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_type_tag 1
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_pin_data_tag 2
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_effect_tag 3
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_color_tag 4
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_color_secondary_tag 5
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_period_ms_tag 6
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_pixels_width_tag 7
 
 /* Struct field encoding specification for nanopb */
 #define wippersnapper_pixels_v1_PixelsCreateRequest_FIELDLIST(X, a) \
@@ -128,22 +160,36 @@ X(a, STATIC,   SINGULAR, UINT32,   pixels_color,      3)
 #define wippersnapper_pixels_v1_PixelsWriteRequest_CALLBACK NULL
 #define wippersnapper_pixels_v1_PixelsWriteRequest_DEFAULT NULL
 
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UENUM,    pixels_type,       1) \
+X(a, STATIC,   SINGULAR, STRING,   pixels_pin_data,   2) \
+X(a, STATIC,   SINGULAR, UENUM,    pixels_effect,     3) \
+X(a, STATIC,   SINGULAR, UINT32,   pixels_color,      4) \
+X(a, STATIC,   SINGULAR, UINT32,   pixels_color_secondary,   5) \
+X(a, STATIC,   SINGULAR, UINT32,   pixels_period_ms,   6) \
+X(a, STATIC,   SINGULAR, UINT32,   pixels_width,      7)
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_CALLBACK NULL
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_DEFAULT NULL
+
 extern const pb_msgdesc_t wippersnapper_pixels_v1_PixelsCreateRequest_msg;
 extern const pb_msgdesc_t wippersnapper_pixels_v1_PixelsCreateResponse_msg;
 extern const pb_msgdesc_t wippersnapper_pixels_v1_PixelsDeleteRequest_msg;
 extern const pb_msgdesc_t wippersnapper_pixels_v1_PixelsWriteRequest_msg;
+extern const pb_msgdesc_t wippersnapper_pixels_v1_PixelsAnimateRequest_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define wippersnapper_pixels_v1_PixelsCreateRequest_fields &wippersnapper_pixels_v1_PixelsCreateRequest_msg
 #define wippersnapper_pixels_v1_PixelsCreateResponse_fields &wippersnapper_pixels_v1_PixelsCreateResponse_msg
 #define wippersnapper_pixels_v1_PixelsDeleteRequest_fields &wippersnapper_pixels_v1_PixelsDeleteRequest_msg
 #define wippersnapper_pixels_v1_PixelsWriteRequest_fields &wippersnapper_pixels_v1_PixelsWriteRequest_msg
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_fields &wippersnapper_pixels_v1_PixelsAnimateRequest_msg
 
 /* Maximum encoded size of messages (where known) */
 #define wippersnapper_pixels_v1_PixelsCreateRequest_size 37
 #define wippersnapper_pixels_v1_PixelsCreateResponse_size 9
 #define wippersnapper_pixels_v1_PixelsDeleteRequest_size 9
 #define wippersnapper_pixels_v1_PixelsWriteRequest_size 15
+#define wippersnapper_pixels_v1_PixelsAnimateRequest_size 35
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -25,6 +25,7 @@ typedef struct _wippersnapper_signal_v1_CreateSignalRequest {
         wippersnapper_pin_v1_ConfigurePinRequests pin_configs;
         wippersnapper_pin_v1_PinEvents pin_events;
         wippersnapper_pin_v1_PinEvent pin_event;
+        wippersnapper_pin_v1_PinEventValue pin_event_value;
     } payload;
 } wippersnapper_signal_v1_CreateSignalRequest;
 
@@ -98,6 +99,7 @@ typedef struct _wippersnapper_signal_v1_PixelsRequest {
         wippersnapper_pixels_v1_PixelsCreateRequest req_pixels_create;
         wippersnapper_pixels_v1_PixelsDeleteRequest req_pixels_delete;
         wippersnapper_pixels_v1_PixelsWriteRequest req_pixels_write;
+        wippersnapper_pixels_v1_PixelsAnimateRequest req_pixels_animate;
     } payload;
 } wippersnapper_signal_v1_PixelsRequest;
 
@@ -191,6 +193,7 @@ extern "C" {
 #define wippersnapper_signal_v1_CreateSignalRequest_pin_configs_tag 6
 #define wippersnapper_signal_v1_CreateSignalRequest_pin_events_tag 7
 #define wippersnapper_signal_v1_CreateSignalRequest_pin_event_tag 15
+#define wippersnapper_signal_v1_CreateSignalRequest_pin_event_value_tag 16
 #define wippersnapper_signal_v1_Ds18x20Request_req_ds18x20_init_tag 1
 #define wippersnapper_signal_v1_Ds18x20Request_req_ds18x20_deinit_tag 2
 #define wippersnapper_signal_v1_Ds18x20Response_resp_ds18x20_init_tag 1
@@ -215,6 +218,7 @@ extern "C" {
 #define wippersnapper_signal_v1_PixelsRequest_req_pixels_create_tag 1
 #define wippersnapper_signal_v1_PixelsRequest_req_pixels_delete_tag 2
 #define wippersnapper_signal_v1_PixelsRequest_req_pixels_write_tag 3
+#define wippersnapper_signal_v1_PixelsRequest_req_pixels_animate_tag 4
 #define wippersnapper_signal_v1_PixelsResponse_resp_pixels_create_tag 1
 #define wippersnapper_signal_v1_ServoRequest_servo_attach_tag 1
 #define wippersnapper_signal_v1_ServoRequest_servo_detach_tag 2
@@ -308,12 +312,14 @@ X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,servo_attach_resp,payload.servo_atta
 #define wippersnapper_signal_v1_PixelsRequest_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,req_pixels_create,payload.req_pixels_create),   1) \
 X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,req_pixels_delete,payload.req_pixels_delete),   2) \
-X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,req_pixels_write,payload.req_pixels_write),   3)
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,req_pixels_write,payload.req_pixels_write),   3) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,req_pixels_animate,payload.req_pixels_animate),   4)
 #define wippersnapper_signal_v1_PixelsRequest_CALLBACK NULL
 #define wippersnapper_signal_v1_PixelsRequest_DEFAULT NULL
 #define wippersnapper_signal_v1_PixelsRequest_payload_req_pixels_create_MSGTYPE wippersnapper_pixels_v1_PixelsCreateRequest
 #define wippersnapper_signal_v1_PixelsRequest_payload_req_pixels_delete_MSGTYPE wippersnapper_pixels_v1_PixelsDeleteRequest
 #define wippersnapper_signal_v1_PixelsRequest_payload_req_pixels_write_MSGTYPE wippersnapper_pixels_v1_PixelsWriteRequest
+#define wippersnapper_signal_v1_PixelsRequest_payload_req_pixels_animate_MSGTYPE wippersnapper_pixels_v1_PixelsAnimateRequest
 
 #define wippersnapper_signal_v1_PixelsResponse_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,resp_pixels_create,payload.resp_pixels_create),   1)
@@ -324,12 +330,14 @@ X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,resp_pixels_create,payload.resp_pixe
 #define wippersnapper_signal_v1_CreateSignalRequest_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,pin_configs,payload.pin_configs),   6) \
 X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,pin_events,payload.pin_events),   7) \
-X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,pin_event,payload.pin_event),  15)
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,pin_event,payload.pin_event),  15) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,pin_event_value,payload.pin_event_value),  16)
 #define wippersnapper_signal_v1_CreateSignalRequest_CALLBACK NULL
 #define wippersnapper_signal_v1_CreateSignalRequest_DEFAULT NULL
 #define wippersnapper_signal_v1_CreateSignalRequest_payload_pin_configs_MSGTYPE wippersnapper_pin_v1_ConfigurePinRequests
 #define wippersnapper_signal_v1_CreateSignalRequest_payload_pin_events_MSGTYPE wippersnapper_pin_v1_PinEvents
 #define wippersnapper_signal_v1_CreateSignalRequest_payload_pin_event_MSGTYPE wippersnapper_pin_v1_PinEvent
+#define wippersnapper_signal_v1_CreateSignalRequest_payload_pin_event_value_MSGTYPE wippersnapper_pin_v1_PinEventValue
 
 #define wippersnapper_signal_v1_SignalResponse_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    BOOL,     (payload,configuration_complete,payload.configuration_complete),   1)
@@ -391,7 +399,7 @@ extern const pb_msgdesc_t wippersnapper_signal_v1_PWMResponse_msg;
 #define wippersnapper_signal_v1_UARTRequest_size 58
 #define wippersnapper_signal_v1_UARTResponse_size 154
 #define wippersnapper_signal_v1_Ds18x20Request_size 39
-#define wippersnapper_signal_v1_Ds18x20Response_size 26
+#define wippersnapper_signal_v1_Ds18x20Response_size 44
 #if defined(wippersnapper_i2c_v1_I2CDeviceInitRequests_size)
 union wippersnapper_signal_v1_I2CRequest_payload_size_union {char f7[(6 + wippersnapper_i2c_v1_I2CDeviceInitRequests_size)]; char f0[227];};
 #define wippersnapper_signal_v1_I2CRequest_size  (0 + sizeof(union wippersnapper_signal_v1_I2CRequest_payload_size_union))